@@ -0,0 +1,242 @@
+/*******************************************************************************************
+*
+*   raylib [bench] - 2D immediate-mode pipeline benchmark
+*
+*   Draws a controlled number of primitives per frame with DrawRectangle(), DrawTexturePro(),
+*   DrawCircleSector(), DrawSplineCatmullRom() and DrawTextEx() and reports, per benchmark:
+*   vertices per second, render batch flushes, draw calls and bytes uploaded per frame
+*
+*   NOTE: Requires raylib compiled with GRAPHICS_API_NULL (cmake -DOPENGL_VERSION=Null), the full
+*   rlgl batching pipeline runs on CPU and every OpenGL command is recorded instead of executed,
+*   results only measure raylib side of the pipeline (no GPU/driver time)
+*
+*   USAGE:
+*       bench_2d [--frames <n>] [--scale <factor>] [--output <file.json>]
+*
+*       --frames    Frames measured per benchmark (default: 120)
+*       --scale     Multiplier applied to primitives count per frame of every benchmark (default: 1.0)
+*       --output    Write JSON results to file instead of standard output
+*
+*   Results are written as JSON, stable keys order, to be diffed across commits
+*
+*   LICENSE: zlib/libpng
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include <stdio.h>          // Required for: fopen(), fprintf(), fclose()
+#include <stdlib.h>         // Required for: atoi(), atof()
+#include <string.h>         // Required for: strcmp()
+
+#if !defined(GRAPHICS_API_NULL)
+    #error "Benchmarks require raylib compiled with GRAPHICS_API_NULL (cmake -DOPENGL_VERSION=Null)"
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_SCREEN_WIDTH      1280
+#define BENCH_SCREEN_HEIGHT      720
+#define BENCH_WARMUP_FRAMES        8        // Frames drawn before measuring (resources upload, first flushes)
+#define BENCH_SPLINE_POINTS       16        // Points per Catmull-Rom spline
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Benchmark resources shared by all benchmarks
+typedef struct BenchResources {
+    Texture2D texture;
+    Font font;
+} BenchResources;
+
+// Benchmark definition
+typedef struct Benchmark {
+    const char *name;               // Benchmark name (drawing function)
+    int count;                      // Primitives drawn per frame (before scale)
+    void (*draw)(const BenchResources *res, int count, int frame);
+} Benchmark;
+
+//------------------------------------------------------------------------------------
+// Benchmarks drawing functions
+//------------------------------------------------------------------------------------
+static void BenchDrawRectangle(const BenchResources *res, int count, int frame)
+{
+    (void)res;      // No shared resources required
+
+    for (int i = 0; i < count; i++)
+    {
+        DrawRectangle((i*7 + frame)%BENCH_SCREEN_WIDTH, (i*13)%BENCH_SCREEN_HEIGHT, 16, 16, (Color){ (unsigned char)i, 128, 255, 255 });
+    }
+}
+
+static void BenchDrawTexturePro(const BenchResources *res, int count, int frame)
+{
+    Rectangle source = { 0, 0, (float)res->texture.width, (float)res->texture.height };
+
+    for (int i = 0; i < count; i++)
+    {
+        Rectangle dest = { (float)((i*7 + frame)%BENCH_SCREEN_WIDTH), (float)((i*13)%BENCH_SCREEN_HEIGHT), 32, 32 };
+        DrawTexturePro(res->texture, source, dest, (Vector2){ 16, 16 }, (float)((i + frame)%360), WHITE);
+    }
+}
+
+static void BenchDrawCircleSector(const BenchResources *res, int count, int frame)
+{
+    (void)res;      // No shared resources required
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 center = { (float)((i*7 + frame)%BENCH_SCREEN_WIDTH), (float)((i*13)%BENCH_SCREEN_HEIGHT) };
+        DrawCircleSector(center, 24.0f, 0.0f, (float)(90 + (i + frame)%270), 36, MAROON);
+    }
+}
+
+static void BenchDrawSplineCatmullRom(const BenchResources *res, int count, int frame)
+{
+    (void)res;      // No shared resources required
+
+    Vector2 points[BENCH_SPLINE_POINTS] = { 0 };
+
+    for (int i = 0; i < count; i++)
+    {
+        for (int p = 0; p < BENCH_SPLINE_POINTS; p++)
+        {
+            points[p].x = (float)(p*BENCH_SCREEN_WIDTH/(BENCH_SPLINE_POINTS - 1));
+            points[p].y = (float)((i*17 + p*53 + frame)%BENCH_SCREEN_HEIGHT);
+        }
+
+        DrawSplineCatmullRom(points, BENCH_SPLINE_POINTS, 2.0f, DARKBLUE);
+    }
+}
+
+static void BenchDrawTextEx(const BenchResources *res, int count, int frame)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Vector2 position = { (float)((i*7 + frame)%BENCH_SCREEN_WIDTH), (float)((i*13)%BENCH_SCREEN_HEIGHT) };
+        DrawTextEx(res->font, "The quick brown fox jumps over the lazy dog", position, 20.0f, 1.0f, BLACK);
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    int frameCount = 120;
+    float scale = 1.0f;
+    const char *outputFileName = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc)) frameCount = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--scale") == 0) && (i + 1 < argc)) scale = (float)atof(argv[++i]);
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) outputFileName = argv[++i];
+        else
+        {
+            fprintf(stderr, "USAGE: %s [--frames <n>] [--scale <factor>] [--output <file.json>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (frameCount < 1) frameCount = 1;
+    if (scale <= 0.0f) scale = 1.0f;
+
+    const Benchmark benchmarks[] = {
+        { "DrawRectangle", 10000, BenchDrawRectangle },
+        { "DrawTexturePro", 10000, BenchDrawTexturePro },
+        { "DrawCircleSector", 2000, BenchDrawCircleSector },
+        { "DrawSplineCatmullRom", 100, BenchDrawSplineCatmullRom },
+        { "DrawTextEx", 500, BenchDrawTextEx },
+    };
+    const int benchmarkCount = sizeof(benchmarks)/sizeof(benchmarks[0]);
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT, "raylib [bench] - 2d pipeline");
+    SetTargetFPS(0);            // No frame time waiting, frames run as fast as possible
+
+    Image image = GenImageChecked(64, 64, 8, 8, RAYWHITE, DARKGRAY);
+    BenchResources res = { 0 };
+    res.texture = LoadTextureFromImage(image);
+    res.font = GetFontDefault();
+    UnloadImage(image);
+
+    FILE *output = stdout;
+    if (outputFileName != NULL)
+    {
+        output = fopen(outputFileName, "wt");
+        if (output == NULL)
+        {
+            fprintf(stderr, "BENCH: [%s] Failed to open output file\n", outputFileName);
+            CloseWindow();
+            return 1;
+        }
+    }
+    //--------------------------------------------------------------------------------------
+
+    fprintf(output, "{\n");
+    fprintf(output, "    \"raylib\": \"%s\",\n", RAYLIB_VERSION);
+    fprintf(output, "    \"frames\": %i,\n", frameCount);
+    fprintf(output, "    \"scale\": %.3f,\n", scale);
+    fprintf(output, "    \"benchmarks\": [\n");
+
+    for (int b = 0; b < benchmarkCount; b++)
+    {
+        const Benchmark *bench = &benchmarks[b];
+        int count = (int)(bench->count*scale);
+        if (count < 1) count = 1;
+
+        for (int frame = 0; frame < BENCH_WARMUP_FRAMES; frame++)
+        {
+            BeginDrawing();
+                ClearBackground(RAYWHITE);
+                bench->draw(&res, count, frame);
+            EndDrawing();
+        }
+
+        rlResetNullCommands();
+        double startTime = GetTime();
+
+        for (int frame = 0; frame < frameCount; frame++)
+        {
+            BeginDrawing();
+                ClearBackground(RAYWHITE);
+                bench->draw(&res, count, frame);
+            EndDrawing();
+        }
+
+        double elapsedTime = GetTime() - startTime;
+        rlNullStats stats = rlGetNullStats();
+        if (elapsedTime <= 0.0) elapsedTime = 1e-9;
+
+        fprintf(output, "        {\n");
+        fprintf(output, "            \"name\": \"%s\",\n", bench->name);
+        fprintf(output, "            \"count\": %i,\n", count);
+        fprintf(output, "            \"frameTimeMs\": %.4f,\n", elapsedTime*1000.0/frameCount);
+        fprintf(output, "            \"verticesPerSecond\": %.0f,\n", (double)stats.batchVertices/elapsedTime);
+        fprintf(output, "            \"verticesPerFrame\": %.1f,\n", (double)stats.batchVertices/frameCount);
+        fprintf(output, "            \"flushesPerFrame\": %.2f,\n", (double)stats.flushes/frameCount);
+        fprintf(output, "            \"drawCallsPerFrame\": %.2f,\n", (double)stats.drawCalls/frameCount);
+        fprintf(output, "            \"stateChangesPerFrame\": %.2f,\n", (double)stats.stateChanges/frameCount);
+        fprintf(output, "            \"uploadBytesPerFrame\": %.0f\n", (double)stats.uploadBytes/frameCount);
+        fprintf(output, "        }%s\n", (b < benchmarkCount - 1)? "," : "");
+    }
+
+    fprintf(output, "    ]\n");
+    fprintf(output, "}\n");
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    if (output != stdout) fclose(output);
+
+    UnloadTexture(res.texture);
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -52,6 +52,7 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_FILEFORMAT_SVG)
     define_if("raylib" SUPPORT_FILEFORMAT_FNT)
     define_if("raylib" SUPPORT_FILEFORMAT_TTF)
+    define_if("raylib" SUPPORT_FILEFORMAT_RFNT)
     define_if("raylib" SUPPORT_TEXT_MANIPULATION)
     define_if("raylib" SUPPORT_MESH_GENERATION)
     define_if("raylib" SUPPORT_FILEFORMAT_OBJ)
@@ -85,10 +85,16 @@
 #define MAX_KEY_PRESSED_QUEUE          16       // Maximum number of keys in the key input queue
 #define MAX_CHAR_PRESSED_QUEUE         16       // Maximum number of characters in the char input queue
 
-#define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
+#define MAX_DECOMPRESSION_SIZE         64       // Max size of decompressed data in MB (DecompressData())
+#define COMPRESSION_TASK_BLOCK_SIZE   1048576   // Data block size compressed per task (CompressData() with tasks dispatcher)
+#define DECOMPRESSION_STREAM_SIZE     1048576   // Max size of data decompressed per update (UpdateDecompressStream())
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define MAX_CAPTURE_JOBS                8       // Maximum number of capture jobs queued for capture worker (screenshots, GIF frames encoding)
+#define MAX_SCREEN_CAPTURES             8       // Maximum number of asynchronous screen captures in progress
+#define SCREEN_CAPTURE_READBACK_FRAMES  2       // Frames waited before retrieving asynchronous screen capture pixels
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -99,14 +105,31 @@
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
+// Stream render batch vertex data through a ring of RL_DEFAULT_BATCH_BUFFERS buffers without implicit syncs
+// Persistent-mapped buffers + fences are used on OpenGL 4.4 (GL_ARB_buffer_storage), buffer orphaning otherwise
+// NOTE: RL_DEFAULT_BATCH_BUFFERS defaults to 3 when enabled, GPU reads previous buffers while CPU writes next one
+//#define RLGL_ENABLE_BATCH_STREAMING            1
+
+// Store render batch vertex data interleaved (position + texcoord + color) in a single vertex buffer
+//#define RLGL_ENABLE_BATCH_INTERLEAVED          1
+
+// Batch up to RL_DEFAULT_BATCH_TEXTURE_SLOTS textures per draw call on default shader, selected per vertex (OpenGL 3.3+)
+//#define RLGL_ENABLE_BATCH_TEXTURE_SLOTS        1
+
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
+#if defined(RLGL_ENABLE_BATCH_STREAMING)
+#define RL_DEFAULT_BATCH_BUFFERS               3      // Default number of batch buffers (ring, GPU reads one while CPU writes next)
+#else
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
+#endif
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+#define RL_DEFAULT_BATCH_TEXTURE_SLOTS         8      // Maximum number of textures sampled by default shader per draw call (RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal Matrix stack
 
 #define RL_MAX_SHADER_LOCATIONS               32      // Maximum number of shader locations supported
+#define RL_MAX_SHADER_UNIFORM_MATRICES       128      // Maximum number of matrices set in a uniform array (bone matrices)
 
 #define RL_CULL_DISTANCE_NEAR               0.01      // Default projection matrix near cull distance
 #define RL_CULL_DISTANCE_FAR              1000.0      // Default projection matrix far cull distance
@@ -119,6 +142,8 @@
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: 3
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: 4
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: 7
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: 8
 
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
@@ -126,6 +151,7 @@
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL       "matModel"          // model matrix
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL      "matNormal"         // normal matrix (transpose(inverse(matModelView))
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
+#define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES "boneMatrices"    // bone matrices array (skinning)
 #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
@@ -171,6 +197,10 @@
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
 
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define IMAGE_TASK_MIN_PIXELS       65536       // Minimum pixels processed per image processing task (see SetTaskDispatchCallback())
+#define IMAGE_ENCODE_BAND_PIXELS   262144       // Minimum pixels encoded per image band task (PNG/QOI parallel export)
 
 //------------------------------------------------------------------------------------
 // Module: rtext - Configuration Flags
@@ -181,6 +211,7 @@
 // Selected desired font fileformats to be supported for loading
 #define SUPPORT_FILEFORMAT_FNT          1
 #define SUPPORT_FILEFORMAT_TTF          1
+#define SUPPORT_FILEFORMAT_RFNT         1
 
 // Support text management functions
 // If not defined, still some functions are supported: TextLength(), TextFormat()
@@ -196,6 +227,10 @@
 #define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: TextSplit()
+#define FONT_CACHE_PAGE_SIZE          512       // Dynamic font glyph cache atlas page size (width and height): LoadFontDynamic()
+#define FONT_CACHE_MAX_PAGES            4       // Dynamic font glyph cache maximum atlas pages, least recently used glyphs evicted when full
+#define FONT_TASK_GLYPHS               16       // Glyphs rasterized per task (LoadFontData() with tasks dispatcher)
+#define RFNT_MAX_ATLAS_SIZE         16384       // Font cache file (.rfnt) maximum atlas width and height
 
 
 //------------------------------------------------------------------------------------
@@ -215,7 +250,7 @@
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_MATERIAL_MAPS              12       // Maximum number of shader maps supported
-#define MAX_MESH_VERTEX_BUFFERS         7       // Maximum vertex buffers (VBO) per mesh
+#define MAX_MESH_VERTEX_BUFFERS         9       // Maximum vertex buffers (VBO) per mesh
 
 //------------------------------------------------------------------------------------
 // Module: raudio - Configuration Flags
@@ -236,6 +271,11 @@
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define AUDIO_COMMAND_QUEUE_SIZE         256    // Audio mixer commands queue size (pending voices/processors changes)
+#define AUDIO_MIXER_BUFFER_FRAMES        512    // Audio mixer frames read per voice and iteration
+#define MUSIC_WORKER_BUFFER_FRAMES     32768    // Music frames decoded ahead by background worker (rounded up to power of two)
+#define MUSIC_WORKER_DECODE_FRAMES      4096    // Music frames decoded by background worker per step
+#define MUSIC_WORKER_SLEEP_TIME            4    // Music background worker sleep time between decoding passes (milliseconds)
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -18,6 +18,7 @@
 *
 *   ADDITIONAL NOTES:
 *       - TRACELOG() function is located in raylib [utils] module
+*       - GRAPHICS_API_NULL uses GLFW null platform without graphic context, no display required (headless)
 *
 *   CONFIGURATION:
 *       #define RCORE_PLATFORM_CUSTOM_FLAG
@@ -193,7 +194,9 @@ void ToggleFullscreen(void)
 
     // Try to enable GPU V-Sync, so frames are limited to screen refresh rate (60Hz -> 60 FPS)
     // NOTE: V-Sync can be enabled by graphic driver configuration
+#if !defined(GRAPHICS_API_NULL)
     if (CORE.Window.flags & FLAG_VSYNC_HINT) glfwSwapInterval(1);
+#endif
 }
 
 // Toggle borderless windowed mode
@@ -309,7 +312,9 @@ void SetWindowState(unsigned int flags)
     // State change: FLAG_VSYNC_HINT
     if (((CORE.Window.flags & FLAG_VSYNC_HINT) != (flags & FLAG_VSYNC_HINT)) && ((flags & FLAG_VSYNC_HINT) > 0))
     {
+#if !defined(GRAPHICS_API_NULL)
         glfwSwapInterval(1);
+#endif
         CORE.Window.flags |= FLAG_VSYNC_HINT;
     }
 
@@ -424,7 +429,9 @@ void ClearWindowState(unsigned int flags)
     // State change: FLAG_VSYNC_HINT
     if (((CORE.Window.flags & FLAG_VSYNC_HINT) > 0) && ((flags & FLAG_VSYNC_HINT) > 0))
     {
+#if !defined(GRAPHICS_API_NULL)
         glfwSwapInterval(0);
+#endif
         CORE.Window.flags &= ~FLAG_VSYNC_HINT;
     }
 
@@ -1021,7 +1028,9 @@ void DisableCursor(void)
 // Swap back buffer with front buffer (screen drawing)
 void SwapScreenBuffer(void)
 {
+#if !defined(GRAPHICS_API_NULL)
     glfwSwapBuffers(platform.handle);
+#endif
 }
 
 //----------------------------------------------------------------------------------
@@ -1258,6 +1267,10 @@ int InitPlatform(void)
 
 #if defined(__APPLE__)
     glfwInitHint(GLFW_COCOA_CHDIR_RESOURCES, GLFW_FALSE);
+#endif
+#if defined(GRAPHICS_API_NULL)
+    // Null graphics backend does not present anything, GLFW null platform requires no display
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
 #endif
     // Initialize GLFW internal global state
     int result = glfwInit();
@@ -1374,6 +1387,11 @@ int InitPlatform(void)
         glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
     }
 
+#if defined(GRAPHICS_API_NULL)
+    // Null graphics backend records OpenGL commands, no graphic context is created
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+#endif
+
     // NOTE: GLFW 3.4+ defers initialization of the Joystick subsystem on the first call to any Joystick related functions.
     // Forcing this initialization here avoids doing it on PollInputEvents() called by EndDrawing() after first frame has been just drawn.
     // The initialization will still happen and possible delays still occur, but before the window is shown, which is a nicer experience.
@@ -1478,14 +1496,19 @@ int InitPlatform(void)
         return -1;
     }
 
+#if defined(GRAPHICS_API_NULL)
+    result = GLFW_NO_ERROR;         // No context to activate
+#else
     glfwMakeContextCurrent(platform.handle);
     result = glfwGetError(NULL);
+#endif
 
     // Check context activation
     if ((result != GLFW_NO_WINDOW_CONTEXT) && (result != GLFW_PLATFORM_ERROR))
     {
         CORE.Window.ready = true;
 
+#if !defined(GRAPHICS_API_NULL)
         glfwSwapInterval(0);        // No V-Sync by default
 
         // Try to enable GPU V-Sync, so frames are limited to screen refresh rate (60Hz -> 60 FPS)
@@ -1497,6 +1520,7 @@ int InitPlatform(void)
             glfwSwapInterval(1);
             TRACELOG(LOG_INFO, "DISPLAY: Trying to enable VSYNC");
         }
+#endif
 
         int fbWidth = CORE.Window.screen.width;
         int fbHeight = CORE.Window.screen.height;
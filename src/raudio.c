@@ -184,6 +184,15 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
 
+// Mixer accumulation vectorization: SSE on x86/x64, NEON on ARM, scalar otherwise
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #define RAUDIO_MIXER_SSE
+    #include <xmmintrin.h>                  // Required for: _mm_loadu_ps(), _mm_storeu_ps(), _mm_add_ps(), _mm_mul_ps()
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define RAUDIO_MIXER_NEON
+    #include <arm_neon.h>                   // Required for: vld1q_f32(), vst1q_f32(), vmlaq_f32()
+#endif
+
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
@@ -298,6 +307,21 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE         256    // Audio mixer commands queue size (pending voices/processors changes)
+#endif
+#ifndef AUDIO_MIXER_BUFFER_FRAMES
+    #define AUDIO_MIXER_BUFFER_FRAMES        512    // Audio mixer frames read per voice and iteration
+#endif
+#ifndef MUSIC_WORKER_BUFFER_FRAMES
+    #define MUSIC_WORKER_BUFFER_FRAMES     32768    // Music frames decoded ahead by background worker (rounded up to power of two)
+#endif
+#ifndef MUSIC_WORKER_DECODE_FRAMES
+    #define MUSIC_WORKER_DECODE_FRAMES      4096    // Music frames decoded by background worker per step
+#endif
+#ifndef MUSIC_WORKER_SLEEP_TIME
+    #define MUSIC_WORKER_SLEEP_TIME            4    // Music background worker sleep time between decoding passes (milliseconds)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -360,6 +384,7 @@ struct rAudioBuffer {
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+    struct MusicWorkerStream *worker; // Music decoded by background worker, read instead of data (if not NULL)
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
@@ -375,12 +400,49 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio mixer command type
+// NOTE: Voices and processors lists are only modified by the audio thread,
+// other threads push commands to a lock-free queue, applied before every mix
+typedef enum {
+    AUDIO_COMMAND_TRACK_BUFFER = 0, // Add audio buffer to mixed voices list
+    AUDIO_COMMAND_UNTRACK_BUFFER,   // Remove audio buffer from mixed voices list
+    AUDIO_COMMAND_ATTACH_PROCESSOR, // Add processor at the end of buffer (or mixed output) processors chain
+    AUDIO_COMMAND_DETACH_PROCESSOR, // Remove processors by callback from buffer (or mixed output) processors chain
+    AUDIO_COMMAND_SYNC              // No operation, waiting for it ensures previous mix has finished
+} AudioCommandType;
+
+// Audio mixer command
+typedef struct AudioCommand {
+    int type;                       // Command type (AudioCommandType)
+    AudioBuffer *buffer;            // Audio buffer, NULL for mixed output processors
+    rAudioProcessor *processor;     // Processor to attach
+    AudioCallback process;          // Processor callback to detach
+} AudioCommand;
+
+// Music stream decoded ahead by background worker thread
+// NOTE: Lock-free single-producer (worker) single-consumer (audio thread) ring buffer,
+// positions are frames counters wrapping around, ring index is position%sizeInFrames
+typedef struct MusicWorkerStream {
+    Music music;                    // Music decoding context, decoder only used by worker
+    unsigned char *data;            // Decoded frames ring buffer (music stream format)
+    ma_uint32 sizeInFrames;         // Ring buffer size in frames (power of two)
+    ma_uint32 writePos;             // Frames decoded position, written by worker
+    ma_uint32 readPos;              // Frames consumed position, written by audio thread
+    ma_uint32 discardPos;           // Frames before this position are discarded (seek), written by worker
+    ma_uint32 seekPos;              // Music position (in frames) of frame at discardPos, written by worker
+    ma_uint32 seekRequest;          // Music position requested + 1 (0: no request), written by other threads
+    ma_uint32 looping;              // Music looping, written by other threads
+    ma_uint32 ended;                // Music decoding finished (not looping), written by worker
+    unsigned int decodedPos;        // Music position (in frames) of next decoded frame, worker only
+    struct MusicWorkerStream *next; // Next stream on worker list
+} MusicWorkerStream;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
+        ma_mutex lock;              // miniaudio mutex lock, serializes commands producers (never locked by audio thread)
         bool isReady;               // Check if audio device is ready
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
@@ -390,6 +452,19 @@ typedef struct AudioData {
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        AudioCommand commands[AUDIO_COMMAND_QUEUE_SIZE]; // Commands ring buffer
+        ma_uint32 head;             // Commands pushed counter, written by producers
+        ma_uint32 tail;             // Commands applied counter, written by audio thread
+        rAudioProcessor *retired;   // Processors detached by audio thread, pending to be freed by producer
+        float buffer[AUDIO_MIXER_BUFFER_FRAMES*AUDIO_DEVICE_CHANNELS];   // Voice frames buffer, used by audio thread
+    } Mixer;
+    struct {
+        ma_thread thread;           // Music decoding worker thread
+        ma_mutex lock;              // Music streams list lock (worker and other threads, never audio thread)
+        ma_uint32 running;          // Worker thread running flag
+        MusicWorkerStream *first;   // Music streams decoded by worker
+    } MusicWorker;
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -413,6 +488,16 @@ static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
 
+static ma_uint32 PushAudioCommand(AudioCommand command);    // Push command to audio mixer queue, returns command position
+static void WaitAudioCommands(ma_uint32 position);          // Wait for audio mixer to apply commands up to position
+static void ApplyAudioCommands(void);                       // Apply pending audio mixer commands (audio thread)
+
+static unsigned int ReadMusicStreamFrames(Music music, void *framesOut, unsigned int frameCount); // Decode music frames, looping decoder if required
+static void RewindMusicStreamDecoder(Music music);          // Rewind music decoder to first frame
+static unsigned int SeekMusicStreamDecoder(Music music, unsigned int positionInFrames); // Seek music decoder, returns position reached
+static ma_thread_result MA_THREADCALL MusicWorkerThread(void *data);  // Music decoding worker thread
+static ma_uint32 ReadMusicWorkerFrames(AudioBuffer *audioBuffer, MusicWorkerStream *stream, void *framesOut, ma_uint32 frameCount); // Read frames decoded by worker (audio thread)
+
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
 static const char *GetFileExtension(const char *fileName);          // Get pointer to extension for a filename string (includes the dot: .png)
@@ -478,8 +563,8 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary.
+    // Mixing happens on a separate thread which means we need to synchronize. Audio thread never locks, voices and processors
+    // changes are pushed to a lock-free commands queue, the mutex only serializes commands pushed from multiple threads
     if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
@@ -488,6 +573,16 @@ void InitAudioDevice(void)
         return;
     }
 
+    // Music worker thread is only started when required, see SetMusicStreamAsync()
+    if (ma_mutex_init(&AUDIO.MusicWorker.lock) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for music worker");
+        ma_mutex_uninit(&AUDIO.System.lock);
+        ma_device_uninit(&AUDIO.System.device);
+        ma_context_uninit(&AUDIO.System.context);
+        return;
+    }
+
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played.
     result = ma_device_start(&AUDIO.System.device);
@@ -514,6 +609,13 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
+        if (ma_atomic_exchange_32(&AUDIO.MusicWorker.running, 0) != 0)
+        {
+            ma_thread_wait(&AUDIO.MusicWorker.thread);
+            TRACELOG(LOG_INFO, "AUDIO: Music worker thread stopped successfully");
+        }
+
+        ma_mutex_uninit(&AUDIO.MusicWorker.lock);
         ma_mutex_uninit(&AUDIO.System.lock);
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
@@ -610,8 +712,8 @@ void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_data_converter_uninit(&buffer->converter, NULL);
         UntrackAudioBuffer(buffer);
+        ma_data_converter_uninit(&buffer->converter, NULL);
         RL_FREE(buffer->data);
         RL_FREE(buffer);
     }
@@ -701,36 +803,24 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
 }
 
 // Track audio buffer to linked list next position
+// NOTE: Buffer is added by audio thread on next mix, no wait required
 void TrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
+    AudioCommand command = { .type = AUDIO_COMMAND_TRACK_BUFFER, .buffer = buffer };
 
-        AUDIO.Buffer.last = buffer;
-    }
+    ma_mutex_lock(&AUDIO.System.lock);
+    PushAudioCommand(command);
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Untrack audio buffer from linked list
+// NOTE: Waits for audio thread to remove the buffer, after return it can be safely freed
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
+    AudioCommand command = { .type = AUDIO_COMMAND_UNTRACK_BUFFER, .buffer = buffer };
 
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
+    ma_mutex_lock(&AUDIO.System.lock);
+    WaitAudioCommands(PushAudioCommand(command));
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -989,8 +1079,8 @@ void UnloadSoundAlias(Sound alias)
     // untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
     if (alias.stream.buffer != NULL)
     {
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
         UntrackAudioBuffer(alias.stream.buffer);
+        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
         RL_FREE(alias.stream.buffer);
     }
 }
@@ -1693,6 +1783,10 @@ bool IsMusicReady(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+    // Stop background decoding, audio buffer is not mixed anymore after unloading the stream
+    MusicWorkerStream *worker = (music.stream.buffer != NULL)? music.stream.buffer->worker : NULL;
+    if (worker != NULL) SetMusicStreamAsync(music, false);
+
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1725,7 +1819,17 @@ void UnloadMusicStream(Music music)
 // Start music playing (open stream)
 void PlayMusicStream(Music music)
 {
-    if (music.stream.buffer != NULL)
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->worker != NULL))
+    {
+        MusicWorkerStream *worker = music.stream.buffer->worker;
+        ma_atomic_store_32(&worker->looping, music.looping);
+
+        // Music fully played, restart it from first frame
+        if (ma_atomic_load_32(&worker->ended) && !IsAudioStreamPlaying(music.stream)) ma_atomic_store_32(&worker->seekRequest, 1);
+
+        PlayAudioStream(music.stream);
+    }
+    else if (music.stream.buffer != NULL)
     {
         // For music streams, we need to make sure we maintain the frame cursor position
         // This is a hack for this section of code in UpdateMusicStream()
@@ -1754,31 +1858,9 @@ void StopMusicStream(Music music)
 {
     StopAudioStream(music.stream);
 
-    switch (music.ctxType)
-    {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
-    }
+    // Decoder is owned by background worker, request it to rewind
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->worker != NULL)) ma_atomic_store_32(&music.stream.buffer->worker->seekRequest, 1);
+    else RewindMusicStreamDecoder(music);
 }
 
 // Seek music to a certain position (in seconds)
@@ -1789,33 +1871,15 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
-    switch (music.ctxType)
+    // Decoder is owned by background worker, request it to seek
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->worker != NULL))
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA:
-        {
-            int qoaFrame = positionInFrames/QOA_FRAME_LEN;
-            qoaplay_seek_frame((qoaplay_desc *)music.ctxData, qoaFrame); // Seeks to QOA frame, not PCM frame
-
-            // We need to compute QOA frame number and update positionInFrames
-            positionInFrames = ((qoaplay_desc *)music.ctxData)->sample_position;
-        } break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, positionInFrames); break;
-#endif
-        default: break;
+        ma_atomic_store_32(&music.stream.buffer->worker->seekRequest, positionInFrames + 1);
+        return;
     }
 
+    positionInFrames = SeekMusicStreamDecoder(music, positionInFrames);
+
     music.stream.buffer->framesProcessed = positionInFrames;
 }
 
@@ -1824,6 +1888,13 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+    // Music decoded by background worker, only looping state needs to be updated
+    if (music.stream.buffer->worker != NULL)
+    {
+        ma_atomic_store_32(&music.stream.buffer->worker->looping, music.looping);
+        return;
+    }
+
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
     // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
@@ -1848,116 +1919,7 @@ void UpdateMusicStream(Music music)
         if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
         else framesToStream = framesLeft;
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
-
-            } break;
-        #endif
-            default: break;
-        }
+        ReadMusicStreamFrames(music, AUDIO.System.pcmBuffer, framesToStream);
 
         UpdateAudioStream(music.stream, AUDIO.System.pcmBuffer, framesToStream);
 
@@ -2017,7 +1979,21 @@ float GetMusicTimeLength(Music music)
 float GetMusicTimePlayed(Music music)
 {
     float secondsPlayed = 0.0f;
-    if (music.stream.buffer != NULL)
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->worker != NULL))
+    {
+        // Music decoded by background worker, position is computed from frames consumed since last seek
+        MusicWorkerStream *worker = music.stream.buffer->worker;
+        ma_uint32 discardPos = ma_atomic_load_32(&worker->discardPos);
+        ma_uint32 seekPos = ma_atomic_load_32(&worker->seekPos);
+        ma_uint32 readPos = ma_atomic_load_32(&worker->readPos);
+        ma_uint32 framesConsumed = ((ma_int32)(readPos - discardPos) > 0)? (readPos - discardPos) : 0;
+
+        ma_uint32 framesPlayed = seekPos + framesConsumed;
+        if (music.frameCount > 0) framesPlayed %= music.frameCount;
+
+        secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
+    }
+    else if (music.stream.buffer != NULL)
     {
 #if defined(SUPPORT_FILEFORMAT_XM)
         if (music.ctxType == MUSIC_MODULE_XM)
@@ -2045,6 +2021,94 @@ float GetMusicTimePlayed(Music music)
     return secondsPlayed;
 }
 
+// Set music decoding on background worker thread
+// NOTE: Worker decodes ahead into a ring buffer read by the mixer, UpdateMusicStream() is not required,
+// music looping state is updated on PlayMusicStream() and UpdateMusicStream() calls
+void SetMusicStreamAsync(Music music, bool async)
+{
+    if (music.stream.buffer == NULL) return;
+
+    MusicWorkerStream *worker = music.stream.buffer->worker;
+
+    if (async && (worker == NULL))
+    {
+        // Start worker thread on first request
+        if (ma_atomic_load_32(&AUDIO.MusicWorker.running) == 0)
+        {
+            ma_atomic_store_32(&AUDIO.MusicWorker.running, 1);
+
+            if (ma_thread_create(&AUDIO.MusicWorker.thread, ma_thread_priority_normal, 0, MusicWorkerThread, NULL, NULL) != MA_SUCCESS)
+            {
+                ma_atomic_store_32(&AUDIO.MusicWorker.running, 0);
+                TRACELOG(LOG_WARNING, "STREAM: Failed to create music worker thread");
+                return;
+            }
+
+            TRACELOG(LOG_INFO, "STREAM: Music worker thread started successfully");
+        }
+
+        worker = (MusicWorkerStream *)RL_CALLOC(1, sizeof(MusicWorkerStream));
+        worker->music = music;
+
+        // NOTE: Ring size must be a power of two, so ring index stays continuous when positions wrap around
+        worker->sizeInFrames = 1;
+        while (worker->sizeInFrames < MUSIC_WORKER_BUFFER_FRAMES) worker->sizeInFrames <<= 1;
+        worker->data = (unsigned char *)RL_CALLOC(worker->sizeInFrames, music.stream.channels*music.stream.sampleSize/8);
+        worker->looping = music.looping;
+
+        // Decoding continues from current played position, frames queued on stream sub-buffers are dropped
+        // NOTE: Seeking is not supported in module formats, decoding continues from decoder position
+        worker->decodedPos = (music.frameCount > 0)? music.stream.buffer->framesProcessed%music.frameCount : 0;
+        worker->seekPos = worker->decodedPos;
+        if ((worker->decodedPos > 0) && (music.ctxType != MUSIC_MODULE_XM) && (music.ctxType != MUSIC_MODULE_MOD)) worker->seekRequest = worker->decodedPos + 1;
+
+        ma_mutex_lock(&AUDIO.MusicWorker.lock);
+        worker->next = AUDIO.MusicWorker.first;
+        AUDIO.MusicWorker.first = worker;
+        ma_mutex_unlock(&AUDIO.MusicWorker.lock);
+
+        // Mixer starts reading from worker ring buffer
+        ma_atomic_store_ptr(&music.stream.buffer->worker, worker);
+    }
+    else if (!async && (worker != NULL))
+    {
+        // Remove stream from worker list, waits for current decoding pass to finish
+        ma_mutex_lock(&AUDIO.MusicWorker.lock);
+        for (MusicWorkerStream **stream = &AUDIO.MusicWorker.first; *stream != NULL; stream = &(*stream)->next)
+        {
+            if (*stream == worker)
+            {
+                *stream = worker->next;
+                break;
+            }
+        }
+        ma_mutex_unlock(&AUDIO.MusicWorker.lock);
+
+        // Make sure mixer is not reading worker ring buffer anymore before freeing it
+        ma_atomic_store_ptr(&music.stream.buffer->worker, NULL);
+
+        AudioCommand command = { .type = AUDIO_COMMAND_SYNC };
+        ma_mutex_lock(&AUDIO.System.lock);
+        WaitAudioCommands(PushAudioCommand(command));
+        ma_mutex_unlock(&AUDIO.System.lock);
+
+        // Sub-buffers refilling continues from current played position on UpdateMusicStream()
+        // NOTE: Seeking is not supported in module formats, refilling continues from decoder position
+        ma_uint32 framesConsumed = ((ma_int32)(worker->readPos - worker->discardPos) > 0)? (worker->readPos - worker->discardPos) : 0;
+        unsigned int positionInFrames = (music.frameCount > 0)? (worker->seekPos + framesConsumed)%music.frameCount : 0;
+
+        if ((music.ctxType == MUSIC_MODULE_XM) || (music.ctxType == MUSIC_MODULE_MOD)) positionInFrames = worker->decodedPos;
+        else positionInFrames = SeekMusicStreamDecoder(music, positionInFrames);
+
+        music.stream.buffer->framesProcessed = positionInFrames;
+        music.stream.buffer->isSubBufferProcessed[0] = true;
+        music.stream.buffer->isSubBufferProcessed[1] = true;
+
+        RL_FREE(worker->data);
+        RL_FREE(worker);
+    }
+}
+
 // Load audio stream (to stream audio pcm data)
 AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
 {
@@ -2219,52 +2283,35 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 // a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element.
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else stream.buffer->processor = processor;
+    AudioCommand command = { .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = stream.buffer, .processor = processor };
 
+    ma_mutex_lock(&AUDIO.System.lock);
+    PushAudioCommand(command);
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Remove processor from audio stream
 void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
+    AudioCommand command = { .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = stream.buffer, .process = process };
+
     ma_mutex_lock(&AUDIO.System.lock);
+    WaitAudioCommands(PushAudioCommand(command));
 
-    rAudioProcessor *processor = stream.buffer->processor;
+    // Free processors removed by audio thread
+    rAudioProcessor *processor = AUDIO.Mixer.retired;
+    AUDIO.Mixer.retired = NULL;
+    ma_mutex_unlock(&AUDIO.System.lock);
 
     while (processor)
     {
         rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
+        RL_FREE(processor);
         processor = next;
     }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Add processor to audio pipeline. Order of processors is important
@@ -2272,58 +2319,461 @@ void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 // these two work on the already mixed output just before sending it to the sound hardware
 void AttachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else AUDIO.mixedProcessor = processor;
+    AudioCommand command = { .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = NULL, .processor = processor };
 
+    ma_mutex_lock(&AUDIO.System.lock);
+    PushAudioCommand(command);
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Remove processor from audio pipeline
 void DetachAudioMixedProcessor(AudioCallback process)
 {
+    AudioCommand command = { .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = NULL, .process = process };
+
     ma_mutex_lock(&AUDIO.System.lock);
+    WaitAudioCommands(PushAudioCommand(command));
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
+    // Free processors removed by audio thread
+    rAudioProcessor *processor = AUDIO.Mixer.retired;
+    AUDIO.Mixer.retired = NULL;
+    ma_mutex_unlock(&AUDIO.System.lock);
 
     while (processor)
     {
         rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
+        RL_FREE(processor);
+        processor = next;
+    }
+}
+
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Push command to audio mixer commands queue, returns queue position after the command
+// NOTE: Producers must hold AUDIO.System.lock, if audio thread is not mixing (device not started),
+// pending commands are applied directly by the calling thread
+static ma_uint32 PushAudioCommand(AudioCommand command)
+{
+    ma_uint32 head = AUDIO.Mixer.head;
+
+    // Wait for a free slot in the commands ring buffer
+    WaitAudioCommands(head + 1 - AUDIO_COMMAND_QUEUE_SIZE);
+
+    AUDIO.Mixer.commands[head%AUDIO_COMMAND_QUEUE_SIZE] = command;
+    ma_atomic_store_explicit_32(&AUDIO.Mixer.head, head + 1, ma_atomic_memory_order_release);
+
+    if (!ma_device_is_started(&AUDIO.System.device)) ApplyAudioCommands();
+
+    return head + 1;
+}
+
+// Wait for audio mixer to apply commands up to queue position
+static void WaitAudioCommands(ma_uint32 position)
+{
+    // NOTE: Counters wrap around, signed difference keeps ordering
+    while ((ma_int32)(position - ma_atomic_load_explicit_32(&AUDIO.Mixer.tail, ma_atomic_memory_order_acquire)) > 0)
+    {
+        if (!ma_device_is_started(&AUDIO.System.device)) ApplyAudioCommands();
+        else ma_sleep(1);
+    }
+}
 
-        if (processor->process == process)
+// Apply pending audio mixer commands
+// NOTE: Called by audio thread before mixing, it's the only place voices and processors lists are modified
+static void ApplyAudioCommands(void)
+{
+    ma_uint32 tail = AUDIO.Mixer.tail;
+    ma_uint32 head = ma_atomic_load_explicit_32(&AUDIO.Mixer.head, ma_atomic_memory_order_acquire);
+
+    for (; tail != head; tail++)
+    {
+        const AudioCommand *command = &AUDIO.Mixer.commands[tail%AUDIO_COMMAND_QUEUE_SIZE];
+        AudioBuffer *buffer = command->buffer;
+
+        switch (command->type)
         {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
+            case AUDIO_COMMAND_TRACK_BUFFER:
+            {
+                if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+                else
+                {
+                    AUDIO.Buffer.last->next = buffer;
+                    buffer->prev = AUDIO.Buffer.last;
+                }
+
+                AUDIO.Buffer.last = buffer;
+            } break;
+            case AUDIO_COMMAND_UNTRACK_BUFFER:
+            {
+                if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+                else buffer->prev->next = buffer->next;
+
+                if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+                else buffer->next->prev = buffer->prev;
+
+                buffer->prev = NULL;
+                buffer->next = NULL;
+            } break;
+            case AUDIO_COMMAND_ATTACH_PROCESSOR:
+            {
+                rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                rAudioProcessor *last = *first;
+
+                while (last && last->next) last = last->next;
 
-            RL_FREE(processor);
+                if (last)
+                {
+                    command->processor->prev = last;
+                    last->next = command->processor;
+                }
+                else *first = command->processor;
+            } break;
+            case AUDIO_COMMAND_DETACH_PROCESSOR:
+            {
+                rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                rAudioProcessor *processor = *first;
+
+                while (processor)
+                {
+                    rAudioProcessor *next = processor->next;
+                    rAudioProcessor *prev = processor->prev;
+
+                    if (processor->process == command->process)
+                    {
+                        if (*first == processor) *first = next;
+                        if (prev) prev->next = next;
+                        if (next) next->prev = prev;
+
+                        // Processor is freed by producer thread, it could allocate/free memory
+                        processor->prev = NULL;
+                        processor->next = AUDIO.Mixer.retired;
+                        AUDIO.Mixer.retired = processor;
+                    }
+
+                    processor = next;
+                }
+            } break;
+            default: break;
         }
+    }
 
-        processor = next;
+    ma_atomic_store_explicit_32(&AUDIO.Mixer.tail, tail, ma_atomic_memory_order_release);
+}
+
+// Decode music frames into provided buffer (music stream format)
+// NOTE: Decoder is rewound when reaching the end of the music, returns frames decoded
+static unsigned int ReadMusicStreamFrames(Music music, void *framesOut, unsigned int frameCount)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    unsigned int framesToStream = frameCount;
+
+    int frameCountStillNeeded = framesToStream;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)framesOut + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)framesOut, framesToStream);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)framesOut + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)framesOut, framesToStream);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)framesOut, framesToStream);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)framesOut, framesToStream);
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)framesOut, framesToStream, 0);
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+        } break;
+    #endif
+        default: break;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    return framesToStream;
 }
 
+// Rewind music decoder to first frame
+static void RewindMusicStreamDecoder(Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
+// Seek music decoder to position (in frames), returns position reached
+// NOTE: Seeking is not supported in module formats
+static unsigned int SeekMusicStreamDecoder(Music music, unsigned int positionInFrames)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            int qoaFrame = positionInFrames/QOA_FRAME_LEN;
+            qoaplay_seek_frame((qoaplay_desc *)music.ctxData, qoaFrame); // Seeks to QOA frame, not PCM frame
+
+            // We need to compute QOA frame number and update positionInFrames
+            positionInFrames = ((qoaplay_desc *)music.ctxData)->sample_position;
+        } break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, positionInFrames); break;
+#endif
+        default: break;
+    }
+
+    return positionInFrames;
+}
+
+// Music decoding worker thread
+// NOTE: Decodes registered music streams ahead until their ring buffers are full, then sleeps
+static ma_thread_result MA_THREADCALL MusicWorkerThread(void *data)
+{
+    (void)data;
+
+    while (ma_atomic_load_32(&AUDIO.MusicWorker.running))
+    {
+        ma_mutex_lock(&AUDIO.MusicWorker.lock);
+
+        for (MusicWorkerStream *stream = AUDIO.MusicWorker.first; stream != NULL; stream = stream->next)
+        {
+            Music *music = &stream->music;
+            ma_uint32 frameSize = music->stream.channels*music->stream.sampleSize/8;
+            ma_uint32 writePos = stream->writePos;
+
+            // Seek requested: move decoder and discard all frames decoded until now
+            ma_uint32 seekRequest = ma_atomic_exchange_32(&stream->seekRequest, 0);
+            if (seekRequest > 0)
+            {
+                unsigned int positionInFrames = seekRequest - 1;
+
+                if (positionInFrames == 0) RewindMusicStreamDecoder(*music);
+                else positionInFrames = SeekMusicStreamDecoder(*music, positionInFrames);
+
+                // NOTE: Storing order matters, ended flag must be cleared before frames are discarded
+                stream->decodedPos = positionInFrames;
+                ma_atomic_store_32(&stream->ended, 0);
+                ma_atomic_store_32(&stream->seekPos, positionInFrames);
+                ma_atomic_store_explicit_32(&stream->discardPos, writePos, ma_atomic_memory_order_release);
+            }
+
+            // NOTE: Music without known length can not loop, decoding ends on first pass
+            bool looping = (ma_atomic_load_32(&stream->looping) != 0) && (music->frameCount > 0);
+
+            // Music decoding finished, only continued if looping was enabled meanwhile
+            if (ma_atomic_load_32(&stream->ended))
+            {
+                if (!looping) continue;
+
+                stream->decodedPos %= music->frameCount;
+                ma_atomic_store_32(&stream->ended, 0);
+            }
+
+            while (true)
+            {
+                // Frames are only free once consumed, discarded frames could still be copied by audio thread
+                // NOTE: After a seek, audio thread releases discarded frames on next read, jumping to discardPos
+                ma_uint32 readPos = ma_atomic_load_explicit_32(&stream->readPos, ma_atomic_memory_order_acquire);
+                ma_uint32 framesFree = stream->sizeInFrames - (writePos - readPos);
+
+                // Decode directly into ring buffer, up to its end
+                ma_uint32 ringIndex = writePos%stream->sizeInFrames;
+                ma_uint32 framesToDecode = stream->sizeInFrames - ringIndex;
+                if (framesToDecode > framesFree) framesToDecode = framesFree;
+                if (framesToDecode > MUSIC_WORKER_DECODE_FRAMES) framesToDecode = MUSIC_WORKER_DECODE_FRAMES;
+                if (!looping && (framesToDecode > (music->frameCount - stream->decodedPos))) framesToDecode = music->frameCount - stream->decodedPos;
+
+                if (!looping && (stream->decodedPos >= music->frameCount))
+                {
+                    ma_atomic_store_explicit_32(&stream->ended, 1, ma_atomic_memory_order_release);
+                    break;
+                }
+
+                if (framesToDecode == 0) break;
+
+                ReadMusicStreamFrames(*music, stream->data + ringIndex*frameSize, framesToDecode);
+
+                stream->decodedPos += framesToDecode;
+                if (looping) stream->decodedPos %= music->frameCount;
+
+                writePos += framesToDecode;
+                ma_atomic_store_explicit_32(&stream->writePos, writePos, ma_atomic_memory_order_release);
+            }
+        }
+
+        ma_mutex_unlock(&AUDIO.MusicWorker.lock);
+
+        ma_sleep(MUSIC_WORKER_SLEEP_TIME);
+    }
+
+    return (ma_thread_result)0;
+}
+
+// Read music frames decoded by background worker (audio thread)
+// NOTE: In case of underrun, missing frames are filled with silence and stream keeps playing
+static ma_uint32 ReadMusicWorkerFrames(AudioBuffer *audioBuffer, MusicWorkerStream *stream, void *framesOut, ma_uint32 frameCount)
+{
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+
+    // NOTE: Loading order matters, ended flag must be consistent with discarded frames and writePos ahead of discardPos
+    ma_uint32 discardPos = ma_atomic_load_explicit_32(&stream->discardPos, ma_atomic_memory_order_acquire);
+    ma_uint32 ended = ma_atomic_load_explicit_32(&stream->ended, ma_atomic_memory_order_acquire);
+    ma_uint32 writePos = ma_atomic_load_explicit_32(&stream->writePos, ma_atomic_memory_order_acquire);
+    ma_uint32 readPos = stream->readPos;
+
+    if ((ma_int32)(discardPos - readPos) > 0) readPos = discardPos;
+
+    ma_uint32 framesAvailable = writePos - readPos;
+    ma_uint32 framesRead = (framesAvailable < frameCount)? framesAvailable : frameCount;
+
+    // Copy frames from ring buffer, in two parts if wrapping around
+    ma_uint32 ringIndex = readPos%stream->sizeInFrames;
+    ma_uint32 framesFirstPart = stream->sizeInFrames - ringIndex;
+    if (framesFirstPart > framesRead) framesFirstPart = framesRead;
+
+    memcpy(framesOut, stream->data + ringIndex*frameSizeInBytes, framesFirstPart*frameSizeInBytes);
+    memcpy((unsigned char *)framesOut + framesFirstPart*frameSizeInBytes, stream->data, (framesRead - framesFirstPart)*frameSizeInBytes);
+
+    ma_atomic_store_explicit_32(&stream->readPos, readPos + framesRead, ma_atomic_memory_order_release);
+    audioBuffer->framesProcessed += framesRead;
+
+    if (framesRead < frameCount)
+    {
+        memset((unsigned char *)framesOut + framesRead*frameSizeInBytes, 0, (frameCount - framesRead)*frameSizeInBytes);
+
+        // Music fully played, stop it, otherwise report silence as read (underrun)
+        if (ended) StopAudioBuffer(audioBuffer);
+        else framesRead = frameCount;
+    }
+
+    return framesRead;
+}
 
 // Log callback function
 static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage)
@@ -2343,6 +2793,10 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         return frameCount;
     }
 
+    // Using music frames decoded by background worker
+    MusicWorkerStream *worker = (MusicWorkerStream *)ma_atomic_load_ptr(&audioBuffer->worker);
+    if (worker != NULL) return ReadMusicWorkerFrames(audioBuffer, worker, framesOut, frameCount);
+
     ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
     ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
 
@@ -2433,7 +2887,7 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count().
-    ma_uint8 inputBuffer[4096] = { 0 };
+    ma_uint8 inputBuffer[4096];     // NOTE: No need to clear, only frames read are converted
     ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     ma_uint32 totalOutputFramesProcessed = 0;
@@ -2482,82 +2936,76 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    // Apply voices and processors changes requested by other threads, no lock required (real-time safe)
+    ApplyAudioCommands();
+
+    for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
     {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+        // Ignore stopped or paused sounds
+        if (!audioBuffer->playing || audioBuffer->paused) continue;
+
+        ma_uint32 framesRead = 0;
+
+        while (1)
         {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+            if (framesRead >= frameCount) break;
 
-            ma_uint32 framesRead = 0;
+            // Just read as much data as we can from the stream
+            ma_uint32 framesToRead = (frameCount - framesRead);
 
-            while (1)
+            while (framesToRead > 0)
             {
-                if (framesRead >= frameCount) break;
-
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+                // NOTE: Mixer buffer is not cleared, only frames read are mixed
+                ma_uint32 framesToReadRightNow = framesToRead;
+                if (framesToReadRightNow > AUDIO_MIXER_BUFFER_FRAMES) framesToReadRightNow = AUDIO_MIXER_BUFFER_FRAMES;
 
-                while (framesToRead > 0)
+                ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, AUDIO.Mixer.buffer, framesToReadRightNow);
+                if (framesJustRead > 0)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+                    float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
+                    float *framesIn = AUDIO.Mixer.buffer;
 
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+                    // Apply processors chain if defined
+                    rAudioProcessor *processor = audioBuffer->processor;
+                    while (processor)
                     {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+                        processor->process(framesIn, framesJustRead);
+                        processor = processor->next;
                     }
 
-                    ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn = tempBuffer;
-
-                        // Apply processors chain if defined
-                        rAudioProcessor *processor = audioBuffer->processor;
-                        while (processor)
-                        {
-                            processor->process(framesIn, framesJustRead);
-                            processor = processor->next;
-                        }
+                    MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
 
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
+                    framesToRead -= framesJustRead;
+                    framesRead += framesJustRead;
+                }
 
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
+                if (!audioBuffer->playing)
+                {
+                    framesRead = frameCount;
+                    break;
+                }
 
-                    if (!audioBuffer->playing)
+                // If we weren't able to read all the frames we requested, break
+                if (framesJustRead < framesToReadRightNow)
+                {
+                    if (!audioBuffer->looping)
                     {
-                        framesRead = frameCount;
+                        StopAudioBuffer(audioBuffer);
                         break;
                     }
-
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
+                    else
                     {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBuffer(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
+                        // Should never get here, but just for safety,
+                        // move the cursor position back to the start and continue the loop
+                        audioBuffer->frameCursorPos = 0;
+                        continue;
                     }
                 }
-
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
             }
+
+            // If for some reason we weren't able to read every frame we'll need to break from the loop
+            // Not doing this could theoretically put us into an infinite loop
+            if (framesToRead > 0) break;
         }
     }
 
@@ -2567,8 +3015,6 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         processor->process(pFramesOut, frameCount);
         processor = processor->next;
     }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
@@ -2578,40 +3024,45 @@ static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 fr
     const float localVolume = buffer->volume;
     const ma_uint32 channels = AUDIO.System.device.playback.channels;
 
+    // Samples levels, alternating left/right for stereo, same level for all channels otherwise
+    float levels[2] = { localVolume, localVolume };
+
     if (channels == 2)  // We consider panning
     {
         const float left = buffer->pan;
         const float right = 1.0f - left;
 
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+        levels[0] = localVolume*0.5f*left*(3.0f - left*left);
+        levels[1] = localVolume*0.5f*right*(3.0f - right*right);
+    }
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+    // Output accumulates input multiplied by level to provided output (usually 0)
+    // NOTE: Vectorized by 4 samples, channels pattern is kept for stereo (2 frames per vector)
+    const ma_uint32 sampleCount = frameCount*channels;
+    ma_uint32 sample = 0;
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+#if defined(RAUDIO_MIXER_SSE)
+    const __m128 level = _mm_setr_ps(levels[0], levels[1], levels[0], levels[1]);
 
-            frameOut += 2;
-            frameIn += 2;
-        }
-    }
-    else  // We do not consider panning
+    for (; (sample + 4) <= sampleCount; sample += 4)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+        __m128 samplesOut = _mm_loadu_ps(framesOut + sample);
+        samplesOut = _mm_add_ps(samplesOut, _mm_mul_ps(_mm_loadu_ps(framesIn + sample), level));
+        _mm_storeu_ps(framesOut + sample, samplesOut);
+    }
+#elif defined(RAUDIO_MIXER_NEON)
+    const float levelsPattern[4] = { levels[0], levels[1], levels[0], levels[1] };
+    const float32x4_t level = vld1q_f32(levelsPattern);
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
-        }
+    for (; (sample + 4) <= sampleCount; sample += 4)
+    {
+        vst1q_f32(framesOut + sample, vmlaq_f32(vld1q_f32(framesOut + sample), vld1q_f32(framesIn + sample), level));
     }
+#endif
+
+    // Remaining samples (all samples if no vectorization available)
+    for (; sample < sampleCount; sample++) framesOut[sample] += (framesIn[sample]*levels[sample%2]);
 }
 
 // Some required functions for audio standalone module version
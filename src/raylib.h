@@ -33,7 +33,6 @@
 *
 *   OPTIONAL DEPENDENCIES (included):
 *       [rcore] msf_gif (Miles Fogle) for GIF recording
-*       [rcore] sinfl (Micha Mettke) for DEFLATE decompression algorithm
 *       [rcore] sdefl (Micha Mettke) for DEFLATE compression algorithm
 *       [rtextures] stb_image (Sean Barret) for images loading (BMP, TGA, PNG, JPEG, HDR...)
 *       [rtextures] stb_image_write (Sean Barret) for image writing (BMP, TGA, PNG, JPG)
@@ -301,6 +300,19 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rtextures and rtext modules
+typedef struct rAtlasSkyline rAtlasSkyline;
+typedef struct rGlyphLookup rGlyphLookup;
+
+// AtlasPacker, rectangles packer for atlas generation (skyline)
+typedef struct AtlasPacker {
+    int width;              // Atlas width
+    int height;             // Atlas height
+    int padding;            // Padding around packed rectangles
+    rAtlasSkyline *skyline; // Packed area top edge (internal)
+} AtlasPacker;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -309,8 +321,25 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rGlyphLookup *lookup;   // Glyphs lookup by codepoint (built on font loading, NULL uses linear search)
 } Font;
 
+// TextLayout, text shaped once (codepoints, glyphs and positions) to be drawn many times
+typedef struct TextLayout {
+    Font font;              // Font used for layout (must be kept loaded while layout is used)
+    float fontSize;         // Font size used for layout
+    float spacing;          // Glyphs spacing used for layout
+    int codepointCount;     // Number of codepoints
+    int *codepoints;        // Codepoints (unicode characters)
+    int *glyphIndices;      // Glyph index in font for every codepoint
+    Vector2 *positions;     // Pen position for every codepoint, relative to text position
+    int lineCount;          // Number of text lines
+    Vector2 size;           // Text size, same as MeasureTextEx()
+    int quadCount;          // Number of glyph quads to draw (spaces, tabs and line breaks are not drawn)
+    Rectangle *srcRecs;     // Glyph quads source rectangles in font atlas
+    Rectangle *dstRecs;     // Glyph quads destination rectangles, relative to text position
+} TextLayout;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -347,8 +376,10 @@ typedef struct Mesh {
     // Animation vertex data
     float *animVertices;    // Animated vertex positions (after bones transformations)
     float *animNormals;     // Animated normals (after bones transformations)
-    unsigned char *boneIds; // Vertex bone ids, max 255 bone ids, up to 4 bones influence by vertex (skinning)
-    float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning)
+    unsigned char *boneIds; // Vertex bone ids, max 255 bone ids, up to 4 bones influence by vertex (skinning) (shader-location = 6)
+    float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning) (shader-location = 7)
+    Matrix *boneMatrices;   // Bones animated transformation matrices (skinning)
+    int boneCount;          // Number of bones matrices
 
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
@@ -433,6 +464,21 @@ typedef struct BoundingBox {
     Vector3 max;            // Maximum vertex box-corner
 } BoundingBox;
 
+// MeshBVHNode, mesh bounding volume hierarchy node
+typedef struct MeshBVHNode {
+    BoundingBox bounds;     // Node bounds (mesh space)
+    int index;              // Leaf: first triangle index, inner node: second child node index (first child is next node)
+    int count;              // Leaf: number of triangles, inner node: 0
+} MeshBVHNode;
+
+// MeshBVH, mesh triangles bounding volume hierarchy (ray collision acceleration)
+typedef struct MeshBVH {
+    int nodeCount;          // Number of nodes in hierarchy
+    int triangleCount;      // Number of triangles referenced
+    MeshBVHNode *nodes;     // Hierarchy nodes (depth-first order, root first)
+    float *vertices;        // Triangles vertex positions, sorted by leaf (XYZ - 9 components per triangle)
+} MeshBVH;
+
 // Wave, audio wave data
 typedef struct Wave {
     unsigned int frameCount;    // Total number of frames (considering channels)
@@ -447,6 +493,11 @@ typedef struct Wave {
 typedef struct rAudioBuffer rAudioBuffer;
 typedef struct rAudioProcessor rAudioProcessor;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rcore module
+typedef struct CompressStream CompressStream;       // Compression stream (DEFLATE)
+typedef struct DecompressStream DecompressStream;   // Decompression stream (DEFLATE)
+
 // AudioStream, custom audio stream
 typedef struct AudioStream {
     rAudioBuffer *buffer;       // Pointer to internal data used by the audio system
@@ -786,7 +837,10 @@ typedef enum {
     SHADER_LOC_MAP_CUBEMAP,         // Shader location: samplerCube texture: cubemap
     SHADER_LOC_MAP_IRRADIANCE,      // Shader location: samplerCube texture: irradiance
     SHADER_LOC_MAP_PREFILTER,       // Shader location: samplerCube texture: prefilter
-    SHADER_LOC_MAP_BRDF             // Shader location: sampler2d texture: brdf
+    SHADER_LOC_MAP_BRDF,            // Shader location: sampler2d texture: brdf
+    SHADER_LOC_VERTEX_BONEIDS,      // Shader location: vertex attribute: boneIds
+    SHADER_LOC_VERTEX_BONEWEIGHTS,  // Shader location: vertex attribute: boneWeights
+    SHADER_LOC_BONE_MATRICES        // Shader location: array of matrices uniform: boneMatrices
 } ShaderLocationIndex;
 
 #define SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
@@ -936,6 +990,9 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef void (*TaskCallback)(void *data, int index);                    // Tasks: Process one task (index)
+typedef void (*TaskDispatchCallback)(TaskCallback task, void *data, int count);  // Tasks: Run all tasks [0..count), returning once all completed
+typedef void (*ScreenCaptureCallback)(int id, Image image);             // Screen capture: Capture completed, image must be unloaded by user
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1075,6 +1132,10 @@ RLAPI void UnloadRandomSequence(int *sequence);                   // Unload rand
 
 // Misc. functions
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI void TakeScreenshotAsync(const char *fileName);             // Takes a screenshot of current screen asynchronously, saved some frames later (no frame hitch)
+RLAPI int RequestScreenCapture(ScreenCaptureCallback callback);   // Request asynchronous capture of current screen on EndDrawing(), returns capture id (0 on failure)
+RLAPI bool IsScreenCaptureReady(int id);                          // Check if a requested screen capture is ready to be loaded (no callback provided)
+RLAPI Image LoadScreenCapture(int id);                            // Load a ready screen capture image, capture id is released
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -1093,6 +1154,7 @@ RLAPI void SetLoadFileDataCallback(LoadFileDataCallback callback); // Set custom
 RLAPI void SetSaveFileDataCallback(SaveFileDataCallback callback); // Set custom file binary data saver
 RLAPI void SetLoadFileTextCallback(LoadFileTextCallback callback); // Set custom file text data loader
 RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom file text data saver
+RLAPI void SetTaskDispatchCallback(TaskDispatchCallback callback); // Set custom tasks dispatcher (i.e. thread pool), used to parallelize image processing, also called from screen capture worker thread
 
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
@@ -1129,6 +1191,14 @@ RLAPI long GetFileModTime(const char *fileName);                  // Get file mo
 // Compression/Encoding functionality
 RLAPI unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be MemFree()
 RLAPI unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be MemFree()
+RLAPI CompressStream *LoadCompressStream(int level);                                                 // Load compression stream (DEFLATE algorithm), level [0..8] or -1 for default, reusable
+RLAPI void UnloadCompressStream(CompressStream *stream);                                             // Unload compression stream
+RLAPI unsigned char *UpdateCompressStream(CompressStream *stream, const unsigned char *data, int dataSize, int *compDataSize); // Update compression stream with new data, returns compressed data (internal memory, valid until next call)
+RLAPI unsigned char *FinishCompressStream(CompressStream *stream, int *compDataSize);                // Finish compression stream, returns last compressed data (internal memory, valid until next call)
+RLAPI DecompressStream *LoadDecompressStream(void);                                                  // Load decompression stream (DEFLATE algorithm), reusable
+RLAPI void UnloadDecompressStream(DecompressStream *stream);                                         // Unload decompression stream
+RLAPI unsigned char *UpdateDecompressStream(DecompressStream *stream, const unsigned char *compData, int compDataSize, int *dataSize); // Update decompression stream with new compressed data, returns decompressed data (internal memory, valid until next call), NULL on failure, call again with compDataSize 0 until dataSize is 0 to get remaining data
+RLAPI bool IsDecompressStreamFinished(DecompressStream *stream);                                     // Check if decompression stream reached the end of DEFLATE data
 RLAPI char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string, memory must be MemFree()
 RLAPI unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize);                    // Decode Base64 string data, memory must be MemFree()
 
@@ -1303,6 +1373,8 @@ RLAPI bool IsImageReady(Image image);
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
+RLAPI bool ExportImageEx(Image image, const char *fileName, int compressionLevel);                       // Export image data to file with compression level (PNG: 0..9, -1 for default), returns true on success
+RLAPI unsigned char *ExportImageToMemoryEx(Image image, const char *fileType, int compressionLevel, int *fileSize); // Export image to memory buffer with compression level (PNG: 0..9, -1 for default)
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
 
 // Image generation functions
@@ -1316,6 +1388,12 @@ RLAPI Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY,
 RLAPI Image GenImageCellular(int width, int height, int tileSize);                                       // Generate image: cellular algorithm, bigger tileSize means bigger cells
 RLAPI Image GenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
 
+// Image atlas packing functions
+RLAPI Image GenImageAtlas(const Image *images, int imageCount, int padding, Rectangle **recs);           // Generate image atlas packing images (minimum area), recs memory must be MemFree()
+RLAPI AtlasPacker LoadAtlasPacker(int width, int height, int padding);                                   // Load atlas rectangles packer (skyline), for incremental packing
+RLAPI void UnloadAtlasPacker(AtlasPacker packer);                                                        // Unload atlas rectangles packer
+RLAPI bool AtlasPackerInsert(AtlasPacker *packer, int width, int height, Rectangle *rec);                // Insert rectangle into atlas packer, returns false if no space left
+
 // Image manipulation functions
 RLAPI Image ImageCopy(Image image);                                                                      // Create an image duplicate (useful for transformations)
 RLAPI Image ImageFromImage(Image image, Rectangle rec);                                                  // Create an image from another image piece
@@ -1348,8 +1426,11 @@ RLAPI void ImageColorBrightness(Image *image, int brightness);
 RLAPI void ImageColorReplace(Image *image, Color color, Color replace);                                  // Modify image color: replace color
 RLAPI Color *LoadImageColors(Image image);                                                               // Load color data from image as a Color array (RGBA - 32bit)
 RLAPI Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a Color array (RGBA - 32bit)
+RLAPI Color *LoadImagePaletteQuantized(Image image, int maxPaletteSize, int *colorCount);                // Load colors palette from image quantized to maxPaletteSize colors (median cut)
+RLAPI unsigned char *LoadImagePaletteIndices(Image image, Color *palette, int colorCount);               // Load image pixels as palette indices (nearest color, up to 256 colors palette)
 RLAPI void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
 RLAPI void UnloadImagePalette(Color *colors);                                                            // Unload colors palette loaded with LoadImagePalette()
+RLAPI void UnloadImagePaletteIndices(unsigned char *indices);                                            // Unload palette indices loaded with LoadImagePaletteIndices()
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
 RLAPI Color GetImageColor(Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
 
@@ -1425,12 +1506,16 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount);  // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize);                              // Load font from file with glyphs rasterized on demand into a cached atlas (TTF/OTF)
+RLAPI Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize); // Load font from memory buffer with glyphs rasterized on demand, fileType refers to extension: i.e. '.ttf'
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
+RLAPI void SetFontTextureFilter(Font font, int filter);                                     // Set font texture filter, applied to all glyph cache atlas pages for dynamic fonts
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
+RLAPI bool ExportFontCache(Font font, const char *fileName, bool compress);                 // Export font as prebaked binary cache (.rfnt), optionally compressed, returns true on success
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
@@ -1440,6 +1525,11 @@ RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 or
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text layout functions (prepared text)
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout, text shaped once to be drawn many times
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                 // Draw text layout at position
+
 // Text font info functions
 RLAPI void SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
@@ -1534,6 +1624,8 @@ RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transfo
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI MeshBVH LoadMeshBVH(Mesh mesh);                                                       // Load mesh bounding volume hierarchy (SAH build) for fast ray collision
+RLAPI void UnloadMeshBVH(MeshBVH bvh);                                                      // Unload mesh bounding volume hierarchy
 
 // Mesh generation functions
 RLAPI Mesh GenMeshPoly(int sides, float radius);                                            // Generate polygonal mesh
@@ -1558,7 +1650,8 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 
 // Model animations loading/unloading functions
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
-RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose
+RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose (CPU skinning)
+RLAPI void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);          // Update model animation mesh bone matrices (GPU skinning)
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
@@ -1570,6 +1663,7 @@ RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius
 RLAPI RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);                    // Get collision info between ray and sphere
 RLAPI RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                                    // Get collision info between ray and box
 RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);                       // Get collision info between ray and mesh
+RLAPI RayCollision GetRayCollisionMeshBVH(Ray ray, MeshBVH bvh, Matrix transform);                  // Get collision info between ray and mesh bounding volume hierarchy
 RLAPI RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);            // Get collision info between ray and triangle
 RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4);    // Get collision info between ray and quad
 
@@ -1632,6 +1726,7 @@ RLAPI void SetMusicPitch(Music music, float pitch);                   // Set pit
 RLAPI void SetMusicPan(Music music, float pan);                       // Set pan for a music (0.5 is center)
 RLAPI float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
+RLAPI void SetMusicStreamAsync(Music music, bool async);              // Set music decoding on background thread (UpdateMusicStream() not required)
 
 // AudioStream management functions
 RLAPI AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Load audio stream (to stream raw audio pcm data)
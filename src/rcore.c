@@ -48,9 +48,8 @@
 *           Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 *
 *       #define SUPPORT_COMPRESSION_API
-*           Support CompressData() and DecompressData() functions, those functions use zlib implementation
-*           provided by stb_image and stb_image_write libraries, so, those libraries must be enabled on textures module
-*           for linkage
+*           Support CompressData() and DecompressData() functions and compression streams (DEFLATE),
+*           compression uses sdefl library, decompression uses an internal streaming decoder
 *
 *       #define SUPPORT_AUTOMATION_EVENTS
 *           Support automatic events recording and playing, useful for automated testing systems or AI based game playing
@@ -123,10 +122,6 @@
 #endif
 
 #if defined(SUPPORT_COMPRESSION_API)
-    #define SINFL_IMPLEMENTATION
-    #define SINFL_NO_SIMD
-    #include "external/sinfl.h"     // Deflate (RFC 1951) decompressor
-
     #define SDEFL_IMPLEMENTATION
     #include "external/sdefl.h"     // Deflate (RFC 1951) compressor
 #endif
@@ -155,6 +150,21 @@ __declspec(dllimport) int __stdcall WideCharToMultiByte(unsigned int cp, unsigne
     #include <mach-o/dyld.h>
 #endif // OSs
 
+// Threads support for capture worker (screenshots and GIF frames encoding and saving)
+#if defined(_WIN32)
+// NOTE: We declare threads API symbols to avoid including windows.h (kernel32.lib linkage required)
+// SRWLOCK and CONDITION_VARIABLE are pointer-sized structures, valid when zero-initialized
+__declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+__declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **lock);
+__declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **lock);
+__declspec(dllimport) int __stdcall SleepConditionVariableSRW(void **condition, void **lock, unsigned long milliseconds, unsigned long flags);
+__declspec(dllimport) void __stdcall WakeAllConditionVariable(void **condition);
+#else
+    #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_lock(), pthread_cond_wait()
+#endif
+
 #define _CRT_INTERNAL_NONSTDC_NAMES  1
 #include <sys/stat.h>               // Required for: stat(), S_ISREG [Used in GetFileModTime(), IsFilePath()]
 
@@ -222,13 +232,33 @@ __declspec(dllimport) int __stdcall WideCharToMultiByte(unsigned int cp, unsigne
 #endif
 
 #ifndef MAX_DECOMPRESSION_SIZE
-    #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
+    #define MAX_DECOMPRESSION_SIZE        64        // Maximum size of decompressed data in MB (DecompressData())
+#endif
+#ifndef COMPRESSION_TASK_BLOCK_SIZE
+    #define COMPRESSION_TASK_BLOCK_SIZE  1048576    // Data block size compressed per task (CompressData() with tasks dispatcher)
 #endif
+#ifndef DECOMPRESSION_STREAM_SIZE
+    #define DECOMPRESSION_STREAM_SIZE    1048576    // Maximum size of data decompressed per update (UpdateDecompressStream())
+#endif
+
+#define COMPRESSION_LEVEL_DEFAULT          8        // Default DEFLATE compression level, same as stbiw
+#define COMPRESSION_WINDOW_SIZE        32768        // DEFLATE matches window size (maximum distance)
+#define INFLATE_FAST_BITS                 10        // DEFLATE decoding codes lookup bits, longer codes decoded bit by bit
 
 #ifndef MAX_AUTOMATION_EVENTS
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef MAX_CAPTURE_JOBS
+    #define MAX_CAPTURE_JOBS               8        // Maximum number of capture jobs queued for capture worker
+#endif
+#ifndef MAX_SCREEN_CAPTURES
+    #define MAX_SCREEN_CAPTURES            8        // Maximum number of asynchronous screen captures in progress
+#endif
+#ifndef SCREEN_CAPTURE_READBACK_FRAMES
+    #define SCREEN_CAPTURE_READBACK_FRAMES 2        // Frames waited before retrieving asynchronous screen capture pixels
+#endif
+
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
 #define FLAG_CLEAR(n, f) ((n) &= ~(f))
@@ -349,14 +379,154 @@ RLAPI const char *raylib_version = RAYLIB_VERSION;  // raylib version exported s
 
 CoreData CORE = { 0 };               // Global CORE state context
 
-#if defined(SUPPORT_SCREEN_CAPTURE)
+#if defined(SUPPORT_SCREEN_CAPTURE) || defined(SUPPORT_GIF_RECORDING)
 static int screenshotCounter = 0;    // Screenshots counter
 #endif
 
+// Capture job, processed by capture worker
+typedef struct CaptureJob {
+    void (*process)(void *data);     // Job processing function (worker thread), data must be freed by it
+    void *data;                      // Job data
+} CaptureJob;
+
+// Capture worker, encodes and saves captured frames on a background thread
+// NOTE: Jobs are processed in order, queue is bounded to limit memory used by pending frames
+typedef struct CaptureWorker {
+#if defined(_WIN32)
+    void *thread;                    // Worker thread handle
+    void *lock;                      // Jobs queue lock (SRWLOCK)
+    void *signal;                    // Jobs queue changes signal (CONDITION_VARIABLE)
+#else
+    pthread_t thread;                // Worker thread
+    pthread_mutex_t lock;            // Jobs queue lock
+    pthread_cond_t signal;           // Jobs queue changes signal
+#endif
+    bool ready;                      // Worker thread running
+    bool closing;                    // Worker thread close requested, remaining jobs are processed
+    CaptureJob jobs[MAX_CAPTURE_JOBS]; // Jobs queue (ring buffer)
+    int first;                       // First job index (job in progress)
+    int count;                       // Jobs count (pending and in progress)
+    unsigned int pushed;             // Jobs pushed counter (job sequence number)
+    unsigned int completed;          // Jobs completed counter
+} CaptureWorker;
+
+// Screen capture state
+typedef enum {
+    SCREEN_CAPTURE_FREE = 0,         // Capture slot available
+    SCREEN_CAPTURE_REQUESTED,        // Capture requested, screen pixels read on next EndDrawing()
+    SCREEN_CAPTURE_READBACK,         // Screen pixels being copied into pixel buffer
+    SCREEN_CAPTURE_PROCESSING,       // Pixels being flipped (and saved) by capture worker
+    SCREEN_CAPTURE_READY             // Capture image ready to be loaded
+} ScreenCaptureState;
+
+// Asynchronous screen capture
+typedef struct ScreenCapture {
+    int id;                          // Capture id
+    int state;                       // Capture state (ScreenCaptureState)
+    ScreenCaptureCallback callback;  // Capture completed callback (NULL if polled or saved)
+    char fileName[512];              // Capture file path to be saved (empty if not saved)
+    Image image;                     // Capture image
+    bool flipped;                    // Image rows bottom-up (pixel buffer readback)
+    unsigned int pixelBuffer;        // Readback pixel buffer id
+    int frames;                      // Frames elapsed since readback
+    unsigned int job;                // Capture worker job sequence number
+} ScreenCapture;
+
+static CaptureWorker captureWorker = { 0 };             // Capture worker state
+static ScreenCapture screenCaptures[MAX_SCREEN_CAPTURES] = { 0 };  // Asynchronous screen captures
+static int screenCaptureCounter = 0;                    // Screen captures counter (ids)
+static bool screenCaptureSync = false;                  // Screen captures read synchronously (pixel buffers not supported)
+
+#if defined(SUPPORT_COMPRESSION_API)
+// DEFLATE decoding Huffman table
+// NOTE: Codes up to INFLATE_FAST_BITS are decoded with a single lookup
+typedef struct InflateTable {
+    unsigned short fast[1 << INFLATE_FAST_BITS]; // Codes lookup by next input bits: (symbol << 4) | code length, 0 for longer codes
+    unsigned short counts[16];       // Codes count per code length
+    unsigned short symbols[288];     // Symbols sorted by code
+} InflateTable;
+
+// DEFLATE decoding state
+typedef enum {
+    INFLATE_BLOCK_HEADER = 0,        // Waiting block header
+    INFLATE_BLOCK_STORED,            // Copying stored (uncompressed) block data
+    INFLATE_BLOCK_HUFFMAN,           // Decoding Huffman coded block symbols
+    INFLATE_FINISHED,                // Last block decoded, stream finished
+    INFLATE_FAILED                   // Invalid data found
+} InflateState;
+
+// Decompression stream (DEFLATE)
+// NOTE: Data is decoded by steps (block header, symbol), if a step runs out of input data
+// it's undone and unconsumed input is kept for next update, so data can be provided in any size chunks
+struct DecompressStream {
+    const unsigned char *input;      // Input data (current update)
+    int inputSize;                   // Input data size
+    int inputPosition;               // Input data next byte position
+    unsigned long long bitBuffer;    // Input bits buffer (LSB first)
+    int bitCount;                    // Input bits count in buffer
+    bool inputEnded;                 // Input data ended during current step
+
+    unsigned char *pending;          // Unconsumed input data kept between updates
+    int pendingSize;                 // Unconsumed input data size
+    int pendingCapacity;             // Unconsumed input data buffer capacity
+
+    unsigned char *output;           // Output data, starting with previous output window (matches history)
+    int outputSize;                  // Output data size
+    int outputCapacity;              // Output data buffer capacity
+    int outputLimit;                 // Output data maximum size
+    bool outputLimitFails;           // Output limit reached fails decoding, otherwise decoding is paused
+
+    int state;                       // Decoding state (InflateState)
+    bool lastBlock;                  // Current block is last block
+    int storedSize;                  // Stored block remaining bytes
+    InflateTable literals;           // Literal/length codes table
+    InflateTable distances;          // Distance codes table
+};
+
+// Compression stream (DEFLATE)
+// NOTE: Data is compressed by blocks of SDEFL_BLK_MAX bytes, previous block tail kept as matches window,
+// every block output ends byte aligned (sync flush) so it can be written right away
+struct CompressStream {
+    struct sdefl sdefl;              // Compressor context, reused by all blocks
+    int level;                       // Compression level [0..8]
+    unsigned char *input;            // Input data: matches window + block data
+    int inputSize;                   // Input data size
+    int windowSize;                  // Matches window size at input start
+    unsigned char *output;           // Compressed data (current update)
+    int outputCapacity;              // Compressed data buffer capacity
+};
+
+// Compression task data, data blocks compressed in parallel
+typedef struct CompressTask {
+    const unsigned char *data;       // Data to compress
+    int dataSize;                    // Data size
+    int blockCount;                  // Data blocks count
+    unsigned char **blocks;          // Compressed data blocks
+    int *blockSizes;                 // Compressed data blocks size
+} CompressTask;
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
+// GIF recorder, frames are encoded and streamed to file by capture worker
+typedef struct GifRecorder {
+    MsfGifState state;               // MSGIF context state (only accessed by capture worker once recording started)
+    FILE *file;                      // Output file
+    int width;                       // Recorded frames width
+    int height;                      // Recorded frames height
+} GifRecorder;
+
+// GIF recorder frame, queued for encoding
+typedef struct GifFrame {
+    GifRecorder *recorder;           // Recorder for the frame
+    unsigned char *pixels;           // Frame pixels (RGBA)
+    int pitch;                       // Frame pixels pitch in bytes (negative for bottom-up rows)
+} GifFrame;
+
 int gifFrameCounter = 0;             // GIF frames counter
 bool gifRecording = false;           // GIF recording state
-MsfGifState gifState = { 0 };        // MSGIF context state
+static GifRecorder *gifRecorder = NULL;         // GIF recorder, NULL if not recording
+static unsigned int gifPixelBuffer = 0;         // GIF frames asynchronous readback pixel buffer (0 if not supported)
+static bool gifPixelBufferPending = false;      // GIF frame readback pending on pixel buffer
 #endif
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
@@ -471,6 +641,28 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *li
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+static bool InitCaptureWorker(void);     // Initialize capture worker thread
+static void CloseCaptureWorker(void);    // Close capture worker thread, after processing pending jobs
+static unsigned int PushCaptureJob(void (*process)(void *data), void *data); // Push job to capture worker (waits if queue is full), returns job sequence number
+static bool IsCaptureJobCompleted(unsigned int job);    // Check if capture worker job has been completed
+
+static int PushScreenCapture(ScreenCaptureCallback callback, const char *fileName);  // Push asynchronous screen capture request
+static void UpdateScreenCaptures(bool flush);   // Update asynchronous screen captures (readback, processing, completion)
+static void UnloadScreenCaptures(void);         // Unload pending asynchronous screen captures
+
+#if defined(SUPPORT_COMPRESSION_API)
+static int GetCompressDataBound(int size);              // Get compressed data maximum size (CompressDataBlock() output)
+static int CompressDataBlock(struct sdefl *sdefl, const unsigned char *data, int start, int end, int level, bool last, unsigned char *output);  // Compress data range as raw DEFLATE blocks
+static void CompressDataTask(void *data, int index);    // Compress data block, task callback
+static int InflateData(DecompressStream *stream);       // Decode DEFLATE data from stream input, returns decoding state
+#endif
+
+#if defined(SUPPORT_GIF_RECORDING)
+static void StartGifRecording(void);     // Start GIF recording, frames streamed to file
+static void StopGifRecording(void);      // Stop GIF recording, file completed by capture worker
+static void CaptureGifFrame(void);       // Capture current frame for GIF recording
+#endif
+
 #if defined(_WIN32)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -668,14 +860,13 @@ void InitWindow(int width, int height, const char *title)
 void CloseWindow(void)
 {
 #if defined(SUPPORT_GIF_RECORDING)
-    if (gifRecording)
-    {
-        MsfGifResult result = msf_gif_end(&gifState);
-        msf_gif_free(result);
-        gifRecording = false;
-    }
+    if (gifRecording) StopGifRecording();
 #endif
 
+    UpdateScreenCaptures(true); // Retrieve pending screen captures readbacks
+    CloseCaptureWorker();       // Wait for pending screenshots and GIF frames to be saved
+    UnloadScreenCaptures();
+
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
@@ -834,6 +1025,8 @@ void EndDrawing(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
+    UpdateScreenCaptures(false);    // Read requested screen captures and retrieve completed ones
+
 #if defined(SUPPORT_GIF_RECORDING)
     // Draw record indicator
     if (gifRecording)
@@ -842,16 +1035,7 @@ void EndDrawing(void)
         gifFrameCounter++;
 
         // NOTE: We record one gif frame every 10 game frames
-        if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0)
-        {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            Vector2 scale = GetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-            msf_gif_frame(&gifState, screenData, 10, 16, (int)((float)CORE.Window.render.width*scale.x)*4);
-
-            RL_FREE(screenData);    // Free image data
-        }
+        if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0) CaptureGifFrame();
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
         if (((gifFrameCounter/15)%2) == 1)
@@ -900,33 +1084,13 @@ void EndDrawing(void)
 #if defined(SUPPORT_GIF_RECORDING)
         if (IsKeyDown(KEY_LEFT_CONTROL))
         {
-            if (gifRecording)
-            {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
-
-                SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
-                msf_gif_free(result);
-
-                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
-            }
-            else
-            {
-                gifRecording = true;
-                gifFrameCounter = 0;
-
-                Vector2 scale = GetWindowScaleDPI();
-                msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-                screenshotCounter++;
-
-                TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
-            }
+            if (gifRecording) StopGifRecording();
+            else StartGifRecording();
         }
         else
 #endif  // SUPPORT_GIF_RECORDING
         {
-            TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+            TakeScreenshotAsync(TextFormat("screenshot%03i.png", screenshotCounter));
             screenshotCounter++;
         }
     }
@@ -1275,6 +1439,8 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
         shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
         shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
         shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+        shader.locs[SHADER_LOC_VERTEX_BONEIDS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
+        shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
 
         // Get handles to GLSL uniform locations (vertex shader)
         shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
@@ -1282,6 +1448,7 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
         shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
         shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
         shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+        shader.locs[SHADER_LOC_BONE_MATRICES] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES);
 
         // Get handles to GLSL uniform locations (fragment shader)
         shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
@@ -1791,6 +1958,67 @@ void TakeScreenshot(const char *fileName)
 #endif
 }
 
+// Takes a screenshot of current screen asynchronously
+// NOTE: Screen is read on EndDrawing() without waiting for GPU, image flipping and
+// encoding (i.e. PNG compression) happen on capture worker, file is saved some frames later
+void TakeScreenshotAsync(const char *fileName)
+{
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    // Security check to (partially) avoid malicious code
+    if (strchr(fileName, '\'') != NULL) { TRACELOG(LOG_WARNING, "SYSTEM: Provided fileName could be potentially malicious, avoid [\'] character"); return; }
+
+    PushScreenCapture(NULL, TextFormat("%s/%s", CORE.Storage.basePath, GetFileName(fileName)));
+#else
+    TRACELOG(LOG_WARNING,"SYSTEM: TakeScreenshotAsync() requires module: rtextures");
+#endif
+}
+
+// Request asynchronous capture of current screen, read on EndDrawing()
+// NOTE: Callback is called from EndDrawing() once capture is completed (some frames later),
+// if no callback provided, use IsScreenCaptureReady() and LoadScreenCapture() to retrieve it
+int RequestScreenCapture(ScreenCaptureCallback callback)
+{
+    return PushScreenCapture(callback, NULL);
+}
+
+// Check if a requested screen capture is ready to be loaded
+bool IsScreenCaptureReady(int id)
+{
+    bool result = false;
+
+    for (int i = 0; i < MAX_SCREEN_CAPTURES; i++)
+    {
+        if ((screenCaptures[i].id == id) && (screenCaptures[i].state == SCREEN_CAPTURE_READY))
+        {
+            result = true;
+            break;
+        }
+    }
+
+    return result;
+}
+
+// Load a ready screen capture image, capture id is released
+// NOTE: Image must be unloaded by user, an empty image is returned if capture is not ready
+Image LoadScreenCapture(int id)
+{
+    Image image = { 0 };
+
+    for (int i = 0; i < MAX_SCREEN_CAPTURES; i++)
+    {
+        if ((screenCaptures[i].id == id) && (screenCaptures[i].state == SCREEN_CAPTURE_READY))
+        {
+            image = screenCaptures[i].image;
+            screenCaptures[i] = (ScreenCapture){ 0 };
+            break;
+        }
+    }
+
+    if (image.data == NULL) TRACELOG(LOG_WARNING, "SYSTEM: Screen capture [ID %i] not ready to be loaded", id);
+
+    return image;
+}
+
 // Setup window configuration flags (view FLAGS)
 // NOTE: This function is expected to be called before window creation,
 // because it sets up some flags for the window creation process.
@@ -1829,31 +2057,37 @@ bool FileExists(const char *fileName)
 // NOTE: Extensions checking is not case-sensitive
 bool IsFileExtension(const char *fileName, const char *ext)
 {
-    #define MAX_FILE_EXTENSION_SIZE  16
-
     bool result = false;
     const char *fileExt = GetFileExtension(fileName);
 
     if (fileExt != NULL)
     {
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_TEXT_MANIPULATION)
-        int extCount = 0;
-        const char **checkExts = TextSplit(ext, ';', &extCount); // WARNING: Module required: rtext
+        int fileExtLength = (int)strlen(fileExt);
 
-        char fileExtLower[MAX_FILE_EXTENSION_SIZE + 1] = { 0 };
-        strncpy(fileExtLower, TextToLower(fileExt), MAX_FILE_EXTENSION_SIZE); // WARNING: Module required: rtext
-
-        for (int i = 0; i < extCount; i++)
+        // Check every extension on the list, separated by ';' (case-insensitive)
+        // NOTE: No static buffers used, function can be called from capture worker (ExportImage())
+        for (const char *checkExt = ext; (checkExt != NULL) && !result; )
         {
-            if (strcmp(fileExtLower, TextToLower(checkExts[i])) == 0)
+            const char *nextExt = strchr(checkExt, ';');
+            int checkExtLength = (nextExt != NULL)? (int)(nextExt - checkExt) : (int)strlen(checkExt);
+
+            if (checkExtLength == fileExtLength)
             {
                 result = true;
-                break;
+
+                for (int i = 0; i < fileExtLength; i++)
+                {
+                    char a = fileExt[i];
+                    char b = checkExt[i];
+                    if ((a >= 'A') && (a <= 'Z')) a += 32;
+                    if ((b >= 'A') && (b <= 'Z')) b += 32;
+
+                    if (a != b) { result = false; break; }
+                }
             }
+
+            checkExt = (nextExt != NULL)? nextExt + 1 : NULL;
         }
-#else
-        if (strcmp(fileExt, ext) == 0) result = true;
-#endif
     }
 
     return result;
@@ -2255,20 +2489,51 @@ long GetFileModTime(const char *fileName)
 //----------------------------------------------------------------------------------
 
 // Compress data (DEFLATE algorithm)
+// NOTE: Large data is compressed by blocks in parallel if a tasks dispatcher is set (see SetTaskDispatchCallback())
 unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize)
 {
-    #define COMPRESSION_QUALITY_DEFLATE  8
-
     unsigned char *compData = NULL;
 
 #if defined(SUPPORT_COMPRESSION_API)
-    // Compress data and generate a valid DEFLATE stream
-    struct sdefl *sdefl = RL_CALLOC(1, sizeof(struct sdefl));   // WARNING: Possible stack overflow, struct sdefl is almost 1MB
-    int bounds = sdefl_bound(dataSize);
-    compData = (unsigned char *)RL_CALLOC(bounds, 1);
+    if (IsTaskDispatchReady() && (dataSize >= 2*COMPRESSION_TASK_BLOCK_SIZE))
+    {
+        // Compress data blocks in parallel, every block uses previous data as matches window,
+        // blocks output is byte aligned so they are concatenated into a single DEFLATE stream
+        CompressTask task = { 0 };
+        task.data = data;
+        task.dataSize = dataSize;
+        task.blockCount = (dataSize + COMPRESSION_TASK_BLOCK_SIZE - 1)/COMPRESSION_TASK_BLOCK_SIZE;
+        task.blocks = (unsigned char **)RL_CALLOC(task.blockCount, sizeof(unsigned char *));
+        task.blockSizes = (int *)RL_CALLOC(task.blockCount, sizeof(int));
 
-    *compDataSize = sdeflate(sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);   // Compression level 8, same as stbiw
-    RL_FREE(sdefl);
+        RunTasks(CompressDataTask, &task, task.blockCount);
+
+        int size = 0;
+        for (int i = 0; i < task.blockCount; i++) size += task.blockSizes[i];
+
+        compData = (unsigned char *)RL_MALLOC(size);
+        *compDataSize = 0;
+
+        for (int i = 0; i < task.blockCount; i++)
+        {
+            memcpy(compData + *compDataSize, task.blocks[i], task.blockSizes[i]);
+            *compDataSize += task.blockSizes[i];
+            RL_FREE(task.blocks[i]);
+        }
+
+        RL_FREE(task.blocks);
+        RL_FREE(task.blockSizes);
+    }
+    else
+    {
+        // Compress data and generate a valid DEFLATE stream
+        struct sdefl *sdefl = RL_MALLOC(sizeof(struct sdefl));      // WARNING: Possible stack overflow, struct sdefl is almost 1MB
+        int bounds = GetCompressDataBound(dataSize);
+        compData = (unsigned char *)RL_MALLOC(bounds);
+
+        *compDataSize = CompressDataBlock(sdefl, data, 0, dataSize, COMPRESSION_LEVEL_DEFAULT, true, compData);
+        RL_FREE(sdefl);
+    }
 
     TRACELOG(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
 #endif
@@ -2277,23 +2542,37 @@ unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDa
 }
 
 // Decompress data (DEFLATE algorithm)
+// NOTE: Output buffer grows as data is decoded, up to MAX_DECOMPRESSION_SIZE
 unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
 {
     unsigned char *data = NULL;
 
 #if defined(SUPPORT_COMPRESSION_API)
     // Decompress data from a valid DEFLATE stream
-    data = (unsigned char *)RL_CALLOC(MAX_DECOMPRESSION_SIZE*1024*1024, 1);
-    int length = sinflate(data, MAX_DECOMPRESSION_SIZE*1024*1024, compData, compDataSize);
+    DecompressStream *stream = (DecompressStream *)RL_CALLOC(1, sizeof(DecompressStream));
+    stream->input = compData;
+    stream->inputSize = compDataSize;
+    stream->outputLimit = MAX_DECOMPRESSION_SIZE*1024*1024;
+    stream->outputLimitFails = true;
+    stream->outputCapacity = (compDataSize < stream->outputLimit/4)? 4*compDataSize + 1024 : stream->outputLimit;
+    stream->output = (unsigned char *)RL_MALLOC(stream->outputCapacity);
+
+    int state = InflateData(stream);
+    if (state == INFLATE_FAILED) TRACELOG(LOG_WARNING, "SYSTEM: Failed to decompress data, invalid or too large DEFLATE data");
+    else if (state != INFLATE_FINISHED) TRACELOG(LOG_WARNING, "SYSTEM: Failed to decompress data, DEFLATE data is incomplete");
 
     // WARNING: RL_REALLOC can make (and leave) data copies in memory, be careful with sensitive compressed data!
     // TODO: Use a different approach, create another buffer, copy data manually to it and wipe original buffer memory
-    unsigned char *temp = (unsigned char *)RL_REALLOC(data, length);
+    data = (unsigned char *)RL_REALLOC(stream->output, (stream->outputSize > 0)? stream->outputSize : 1);
 
-    if (temp != NULL) data = temp;
-    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to re-allocate required decompression memory");
+    if (data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to re-allocate required decompression memory");
+        data = stream->output;
+    }
 
-    *dataSize = length;
+    *dataSize = stream->outputSize;
+    RL_FREE(stream);
 
     TRACELOG(LOG_INFO, "SYSTEM: Decompress data: Comp. size: %i -> Original size: %i", compDataSize, *dataSize);
 #endif
@@ -2301,6 +2580,247 @@ unsigned char *DecompressData(const unsigned char *compData, int compDataSize, i
     return data;
 }
 
+// Load compression stream (DEFLATE algorithm), level [0..8] or -1 for default
+// NOTE: Stream can be reused for multiple data streams, compressor memory is only allocated once
+CompressStream *LoadCompressStream(int level)
+{
+    CompressStream *stream = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    stream = (CompressStream *)RL_CALLOC(1, sizeof(CompressStream));
+    stream->level = ((level < 0) || (level > SDEFL_LVL_MAX))? COMPRESSION_LEVEL_DEFAULT : level;
+    stream->input = (unsigned char *)RL_MALLOC(COMPRESSION_WINDOW_SIZE + SDEFL_BLK_MAX);
+    stream->outputCapacity = GetCompressDataBound(SDEFL_BLK_MAX);
+    stream->output = (unsigned char *)RL_MALLOC(stream->outputCapacity);
+#endif
+
+    return stream;
+}
+
+// Unload compression stream
+void UnloadCompressStream(CompressStream *stream)
+{
+#if defined(SUPPORT_COMPRESSION_API)
+    if (stream == NULL) return;
+
+    RL_FREE(stream->input);
+    RL_FREE(stream->output);
+    RL_FREE(stream);
+#endif
+}
+
+// Update compression stream with new data, returns compressed data available
+// NOTE: Returned data is stream internal memory, valid until next stream call
+unsigned char *UpdateCompressStream(CompressStream *stream, const unsigned char *data, int dataSize, int *compDataSize)
+{
+    *compDataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (stream == NULL) return NULL;
+
+    while (dataSize > 0)
+    {
+        int size = stream->windowSize + SDEFL_BLK_MAX - stream->inputSize;
+        if (size > dataSize) size = dataSize;
+
+        memcpy(stream->input + stream->inputSize, data, size);
+        stream->inputSize += size;
+        data += size;
+        dataSize -= size;
+
+        // Block completed, compress it and keep block end as next block matches window
+        if ((stream->inputSize - stream->windowSize) == SDEFL_BLK_MAX)
+        {
+            int capacity = *compDataSize + GetCompressDataBound(SDEFL_BLK_MAX);
+
+            if (stream->outputCapacity < capacity)
+            {
+                stream->outputCapacity = capacity;
+                stream->output = (unsigned char *)RL_REALLOC(stream->output, capacity);
+            }
+
+            *compDataSize += CompressDataBlock(&stream->sdefl, stream->input, stream->windowSize, stream->inputSize, stream->level, false, stream->output + *compDataSize);
+
+            memmove(stream->input, stream->input + stream->inputSize - COMPRESSION_WINDOW_SIZE, COMPRESSION_WINDOW_SIZE);
+            stream->inputSize = COMPRESSION_WINDOW_SIZE;
+            stream->windowSize = COMPRESSION_WINDOW_SIZE;
+        }
+    }
+
+    return stream->output;
+#else
+    return NULL;
+#endif
+}
+
+// Finish compression stream, returns last compressed data, stream is ready to compress a new data stream
+// NOTE: Returned data is stream internal memory, valid until next stream call
+unsigned char *FinishCompressStream(CompressStream *stream, int *compDataSize)
+{
+    *compDataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (stream == NULL) return NULL;
+
+    int capacity = GetCompressDataBound(stream->inputSize - stream->windowSize);
+
+    if (stream->outputCapacity < capacity)
+    {
+        stream->outputCapacity = capacity;
+        stream->output = (unsigned char *)RL_REALLOC(stream->output, capacity);
+    }
+
+    *compDataSize = CompressDataBlock(&stream->sdefl, stream->input, stream->windowSize, stream->inputSize, stream->level, true, stream->output);
+
+    stream->inputSize = 0;
+    stream->windowSize = 0;
+
+    return stream->output;
+#else
+    return NULL;
+#endif
+}
+
+// Load decompression stream (DEFLATE algorithm)
+// NOTE: Stream can be reused, a new data stream is started on update after previous one finished
+DecompressStream *LoadDecompressStream(void)
+{
+    DecompressStream *stream = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    stream = (DecompressStream *)RL_CALLOC(1, sizeof(DecompressStream));
+#endif
+
+    return stream;
+}
+
+// Unload decompression stream
+void UnloadDecompressStream(DecompressStream *stream)
+{
+#if defined(SUPPORT_COMPRESSION_API)
+    if (stream == NULL) return;
+
+    RL_FREE(stream->pending);
+    RL_FREE(stream->output);
+    RL_FREE(stream);
+#endif
+}
+
+// Update decompression stream with new compressed data, returns decompressed data available (NULL on failure)
+// NOTE: Returned data is stream internal memory, valid until next stream call,
+// data decompressed by a single update is limited to DECOMPRESSION_STREAM_SIZE, decoding is paused
+// keeping unconsumed input, remaining data is returned by next updates (compDataSize can be 0),
+// memory used is the data decompressed on update plus the matches window (32KB)
+unsigned char *UpdateDecompressStream(DecompressStream *stream, const unsigned char *compData, int compDataSize, int *dataSize)
+{
+    *dataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (stream == NULL) return NULL;
+
+    // Previous data stream finished and no new data, nothing remaining to return
+    if ((stream->state == INFLATE_FINISHED) && (compDataSize <= 0)) return stream->output + stream->outputSize;
+
+    // Previous data stream finished, start a new one
+    if ((stream->state == INFLATE_FINISHED) || (stream->state == INFLATE_FAILED))
+    {
+        stream->state = INFLATE_BLOCK_HEADER;
+        stream->bitBuffer = 0;
+        stream->bitCount = 0;
+        stream->pendingSize = 0;
+        stream->outputSize = 0;
+    }
+
+    // Keep previous output end as matches window
+    if (stream->outputSize > COMPRESSION_WINDOW_SIZE)
+    {
+        memmove(stream->output, stream->output + stream->outputSize - COMPRESSION_WINDOW_SIZE, COMPRESSION_WINDOW_SIZE);
+        stream->outputSize = COMPRESSION_WINDOW_SIZE;
+    }
+
+    int windowSize = stream->outputSize;
+
+    // Append new data to unconsumed input, if any
+    if (stream->pendingSize > 0)
+    {
+        if (stream->pendingCapacity < (stream->pendingSize + compDataSize))
+        {
+            stream->pendingCapacity = stream->pendingSize + compDataSize;
+            stream->pending = (unsigned char *)RL_REALLOC(stream->pending, stream->pendingCapacity);
+        }
+
+        if (compDataSize > 0) memcpy(stream->pending + stream->pendingSize, compData, compDataSize);
+        stream->input = stream->pending;
+        stream->inputSize = stream->pendingSize + compDataSize;
+    }
+    else
+    {
+        stream->input = compData;
+        stream->inputSize = compDataSize;
+    }
+
+    stream->inputPosition = 0;
+    stream->outputLimit = windowSize + DECOMPRESSION_STREAM_SIZE;
+
+    int outputCapacity = windowSize + 2*stream->inputSize + 1024;
+    if (outputCapacity > stream->outputLimit) outputCapacity = stream->outputLimit;
+
+    if (stream->outputCapacity < outputCapacity)
+    {
+        stream->outputCapacity = outputCapacity;
+        stream->output = (unsigned char *)RL_REALLOC(stream->output, stream->outputCapacity);
+    }
+
+    int state = InflateData(stream);
+
+    // Keep unconsumed input for next update
+    stream->pendingSize = 0;
+
+    if ((state != INFLATE_FINISHED) && (state != INFLATE_FAILED) && (stream->inputPosition < stream->inputSize))
+    {
+        int size = stream->inputSize - stream->inputPosition;
+
+        if (stream->input == stream->pending) memmove(stream->pending, stream->pending + stream->inputPosition, size);
+        else
+        {
+            if (stream->pendingCapacity < size)
+            {
+                stream->pendingCapacity = size;
+                stream->pending = (unsigned char *)RL_REALLOC(stream->pending, size);
+            }
+
+            memcpy(stream->pending, stream->input + stream->inputPosition, size);
+        }
+
+        stream->pendingSize = size;
+    }
+
+    stream->input = NULL;
+
+    if (state == INFLATE_FAILED)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to decompress stream data, invalid DEFLATE data");
+        return NULL;
+    }
+
+    *dataSize = stream->outputSize - windowSize;
+
+    return stream->output + windowSize;
+#else
+    return NULL;
+#endif
+}
+
+// Check if decompression stream reached the end of DEFLATE data stream
+bool IsDecompressStreamFinished(DecompressStream *stream)
+{
+#if defined(SUPPORT_COMPRESSION_API)
+    return ((stream != NULL) && (stream->state == INFLATE_FINISHED));
+#else
+    return false;
+#endif
+}
+
 // Encode data to Base64 string
 char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
 {
@@ -3537,6 +4057,922 @@ static void RecordAutomationEvent(void)
 }
 #endif
 
+// Capture worker jobs queue synchronization
+#if defined(_WIN32)
+    #define CAPTURE_WORKER_LOCK()     AcquireSRWLockExclusive(&captureWorker.lock)
+    #define CAPTURE_WORKER_UNLOCK()   ReleaseSRWLockExclusive(&captureWorker.lock)
+    #define CAPTURE_WORKER_WAIT()     SleepConditionVariableSRW(&captureWorker.signal, &captureWorker.lock, 0xFFFFFFFF, 0)
+    #define CAPTURE_WORKER_SIGNAL()   WakeAllConditionVariable(&captureWorker.signal)
+#else
+    #define CAPTURE_WORKER_LOCK()     pthread_mutex_lock(&captureWorker.lock)
+    #define CAPTURE_WORKER_UNLOCK()   pthread_mutex_unlock(&captureWorker.lock)
+    #define CAPTURE_WORKER_WAIT()     pthread_cond_wait(&captureWorker.signal, &captureWorker.lock)
+    #define CAPTURE_WORKER_SIGNAL()   pthread_cond_broadcast(&captureWorker.signal)
+#endif
+
+// Capture worker thread, processes queued jobs in order until closed
+#if defined(_WIN32)
+static unsigned long __stdcall CaptureWorkerThread(void *arg)
+#else
+static void *CaptureWorkerThread(void *arg)
+#endif
+{
+    CAPTURE_WORKER_LOCK();
+
+    while (true)
+    {
+        while ((captureWorker.count == 0) && !captureWorker.closing) CAPTURE_WORKER_WAIT();
+
+        if (captureWorker.count == 0) break;    // Closing and no jobs left
+
+        // NOTE: Job keeps its queue slot while processed, it is released once completed
+        CaptureJob job = captureWorker.jobs[captureWorker.first];
+
+        CAPTURE_WORKER_UNLOCK();
+        job.process(job.data);
+        CAPTURE_WORKER_LOCK();
+
+        captureWorker.first = (captureWorker.first + 1)%MAX_CAPTURE_JOBS;
+        captureWorker.count--;
+        captureWorker.completed++;
+        CAPTURE_WORKER_SIGNAL();
+    }
+
+    CAPTURE_WORKER_UNLOCK();
+
+    return 0;
+}
+
+// Initialize capture worker thread
+static bool InitCaptureWorker(void)
+{
+    if (captureWorker.ready) return true;
+
+    captureWorker.first = 0;
+    captureWorker.count = 0;
+    captureWorker.closing = false;
+
+#if defined(_WIN32)
+    captureWorker.thread = CreateThread(NULL, 0, CaptureWorkerThread, NULL, 0, NULL);
+    captureWorker.ready = (captureWorker.thread != NULL);
+#else
+    pthread_mutex_init(&captureWorker.lock, NULL);
+    pthread_cond_init(&captureWorker.signal, NULL);
+
+    captureWorker.ready = (pthread_create(&captureWorker.thread, NULL, CaptureWorkerThread, NULL) == 0);
+
+    if (!captureWorker.ready)
+    {
+        pthread_cond_destroy(&captureWorker.signal);
+        pthread_mutex_destroy(&captureWorker.lock);
+    }
+#endif
+
+    if (!captureWorker.ready) TRACELOG(LOG_WARNING, "SYSTEM: Failed to create capture worker thread, frames processed on main thread");
+
+    return captureWorker.ready;
+}
+
+// Close capture worker thread, after processing pending jobs
+static void CloseCaptureWorker(void)
+{
+    if (!captureWorker.ready) return;
+
+    CAPTURE_WORKER_LOCK();
+    captureWorker.closing = true;
+    CAPTURE_WORKER_SIGNAL();
+    CAPTURE_WORKER_UNLOCK();
+
+#if defined(_WIN32)
+    WaitForSingleObject(captureWorker.thread, 0xFFFFFFFF);
+    CloseHandle(captureWorker.thread);
+#else
+    pthread_join(captureWorker.thread, NULL);
+    pthread_cond_destroy(&captureWorker.signal);
+    pthread_mutex_destroy(&captureWorker.lock);
+#endif
+
+    captureWorker.ready = false;
+}
+
+// Push job to capture worker, returns job sequence number
+// NOTE: Waits for a queue slot if worker is behind, job is processed on calling thread if no worker available
+static unsigned int PushCaptureJob(void (*process)(void *data), void *data)
+{
+    if (!captureWorker.ready)
+    {
+        process(data);
+        return 0;
+    }
+
+    CAPTURE_WORKER_LOCK();
+
+    while (captureWorker.count == MAX_CAPTURE_JOBS) CAPTURE_WORKER_WAIT();
+
+    captureWorker.jobs[(captureWorker.first + captureWorker.count)%MAX_CAPTURE_JOBS] = (CaptureJob){ process, data };
+    captureWorker.count++;
+    unsigned int job = ++captureWorker.pushed;
+    CAPTURE_WORKER_SIGNAL();
+
+    CAPTURE_WORKER_UNLOCK();
+
+    return job;
+}
+
+// Check if capture worker job has been completed
+// NOTE: Job results written by worker are visible to calling thread once completed
+static bool IsCaptureJobCompleted(unsigned int job)
+{
+    if (!captureWorker.ready) return true;  // Jobs processed on calling thread or worker already closed
+
+    CAPTURE_WORKER_LOCK();
+    bool completed = ((int)(captureWorker.completed - job) >= 0);
+    CAPTURE_WORKER_UNLOCK();
+
+    return completed;
+}
+
+// Process screen capture pixels: flip rows (if required) and save file (capture worker job)
+static void ProcessScreenCapture(void *data)
+{
+    ScreenCapture *capture = (ScreenCapture *)data;
+    unsigned char *pixels = (unsigned char *)capture->image.data;
+    int pitch = capture->image.width*4;
+
+    if (capture->flipped)
+    {
+        // Flip image vertically, swapping rows, and set alpha to 255 (no transparent image retrieval)
+        // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+        unsigned char *row = (unsigned char *)RL_MALLOC(pitch);
+
+        for (int y = 0; y < capture->image.height/2; y++)
+        {
+            unsigned char *top = pixels + y*pitch;
+            unsigned char *bottom = pixels + (capture->image.height - 1 - y)*pitch;
+
+            memcpy(row, top, pitch);
+            memcpy(top, bottom, pitch);
+            memcpy(bottom, row, pitch);
+
+            for (int x = 3; x < pitch; x += 4) { top[x] = 255; bottom[x] = 255; }
+        }
+
+        // Middle row for odd heights, not swapped
+        if ((capture->image.height%2) != 0)
+        {
+            unsigned char *middle = pixels + (capture->image.height/2)*pitch;
+            for (int x = 3; x < pitch; x += 4) middle[x] = 255;
+        }
+
+        RL_FREE(row);
+        capture->flipped = false;
+    }
+
+    if (capture->fileName[0] != '\0')
+    {
+#if defined(SUPPORT_MODULE_RTEXTURES)
+        // NOTE: Image encoding (i.e. PNG compression) is the slowest part of a screenshot,
+        // encoding tasks are run by tasks dispatcher from this worker thread (see SetTaskDispatchCallback())
+        if (ExportImage(capture->image, capture->fileName)) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", capture->fileName);
+        else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", capture->fileName);
+#endif
+        RL_FREE(capture->image.data);
+        capture->image.data = NULL;
+    }
+}
+
+// Push asynchronous screen capture request, returns capture id (0 on failure)
+static int PushScreenCapture(ScreenCaptureCallback callback, const char *fileName)
+{
+    for (int i = 0; i < MAX_SCREEN_CAPTURES; i++)
+    {
+        ScreenCapture *capture = &screenCaptures[i];
+
+        if (capture->state == SCREEN_CAPTURE_FREE)
+        {
+            InitCaptureWorker();
+
+            screenCaptureCounter++;
+            if (screenCaptureCounter <= 0) screenCaptureCounter = 1;
+
+            *capture = (ScreenCapture){ 0 };
+            capture->id = screenCaptureCounter;
+            capture->state = SCREEN_CAPTURE_REQUESTED;
+            capture->callback = callback;
+            if (fileName != NULL) strncpy(capture->fileName, fileName, sizeof(capture->fileName) - 1);
+
+            return capture->id;
+        }
+    }
+
+    TRACELOG(LOG_WARNING, "SYSTEM: Too many screen captures in progress, max: %i", MAX_SCREEN_CAPTURES);
+
+    return 0;
+}
+
+// Update asynchronous screen captures, called on EndDrawing()
+// NOTE: Requested captures are read into pixel buffers (no GPU sync), pixel buffers are mapped
+// SCREEN_CAPTURE_READBACK_FRAMES frames later (copy completed) and pixels processed by capture worker,
+// flush retrieves all readbacks immediately (closing)
+static void UpdateScreenCaptures(bool flush)
+{
+    for (int i = 0; i < MAX_SCREEN_CAPTURES; i++)
+    {
+        ScreenCapture *capture = &screenCaptures[i];
+
+        if (capture->state == SCREEN_CAPTURE_READBACK)
+        {
+            // NOTE: Elapsed frames are counted per capture, frame counter can be reset (SetAutomationEventBaseFrame())
+            capture->frames++;
+            if (!flush && (capture->frames < SCREEN_CAPTURE_READBACK_FRAMES)) continue;
+
+            int size = capture->image.width*capture->image.height*4;
+            unsigned char *data = (unsigned char *)rlMapPixelBuffer(capture->pixelBuffer, size);
+
+            if (data != NULL)
+            {
+                capture->image.data = RL_MALLOC(size);
+                memcpy(capture->image.data, data, size);
+                rlUnmapPixelBuffer(capture->pixelBuffer);
+
+                capture->flipped = true;
+                capture->job = PushCaptureJob(ProcessScreenCapture, capture);
+                capture->state = SCREEN_CAPTURE_PROCESSING;
+            }
+            else
+            {
+                // Mapping not supported, fallback to synchronous readback for next captures
+                if (!screenCaptureSync) TRACELOG(LOG_WARNING, "SYSTEM: Failed to map screen capture pixel buffer, using synchronous readback");
+                screenCaptureSync = true;
+                capture->state = flush? SCREEN_CAPTURE_FREE : SCREEN_CAPTURE_REQUESTED;
+            }
+
+            rlUnloadPixelBuffer(capture->pixelBuffer);
+            capture->pixelBuffer = 0;
+        }
+        else if ((capture->state == SCREEN_CAPTURE_REQUESTED) && !flush)
+        {
+            Vector2 scale = GetWindowScaleDPI();
+            capture->image.width = (int)((float)CORE.Window.render.width*scale.x);
+            capture->image.height = (int)((float)CORE.Window.render.height*scale.y);
+            capture->image.mipmaps = 1;
+            capture->image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+            if (!screenCaptureSync) capture->pixelBuffer = rlLoadPixelBuffer(capture->image.width*capture->image.height*4);
+
+            if (capture->pixelBuffer != 0)
+            {
+                rlReadScreenPixelsToBuffer(capture->pixelBuffer, capture->image.width, capture->image.height);
+                capture->frames = 0;
+                capture->state = SCREEN_CAPTURE_READBACK;
+            }
+            else
+            {
+                // Pixel buffers not supported, synchronous readback (already flipped)
+                capture->image.data = rlReadScreenPixels(capture->image.width, capture->image.height);
+                capture->flipped = false;
+                capture->job = PushCaptureJob(ProcessScreenCapture, capture);
+                capture->state = SCREEN_CAPTURE_PROCESSING;
+            }
+        }
+
+        if ((capture->state == SCREEN_CAPTURE_PROCESSING) && !flush && IsCaptureJobCompleted(capture->job))
+        {
+            if (capture->fileName[0] != '\0') capture->state = SCREEN_CAPTURE_FREE;    // Saved by worker
+            else if (capture->callback != NULL)
+            {
+                ScreenCapture completed = *capture;
+                *capture = (ScreenCapture){ 0 };    // Capture slot released before callback, it can request new captures
+                completed.callback(completed.id, completed.image);  // NOTE: Image is owned by user
+            }
+            else capture->state = SCREEN_CAPTURE_READY;
+        }
+    }
+}
+
+// Unload pending asynchronous screen captures
+// NOTE: Capture worker must be closed, all jobs completed
+static void UnloadScreenCaptures(void)
+{
+    for (int i = 0; i < MAX_SCREEN_CAPTURES; i++)
+    {
+        ScreenCapture *capture = &screenCaptures[i];
+
+        if (capture->pixelBuffer != 0) rlUnloadPixelBuffer(capture->pixelBuffer);
+        RL_FREE(capture->image.data);
+
+        screenCaptures[i] = (ScreenCapture){ 0 };
+    }
+}
+
+#if defined(SUPPORT_GIF_RECORDING)
+
+// Encode GIF frame and write it to recording file (capture worker job)
+static void EncodeGifFrame(void *data)
+{
+    GifFrame *frame = (GifFrame *)data;
+
+    // NOTE: Color quantization and LZW compression happen here, encoded frame is written and released
+    msf_gif_frame_to_file(&frame->recorder->state, frame->pixels, 10, 16, frame->pitch);
+
+    RL_FREE(frame->pixels);
+    RL_FREE(frame);
+}
+
+// Finish GIF recording file (capture worker job)
+static void FinishGifRecording(void *data)
+{
+    GifRecorder *recorder = (GifRecorder *)data;
+
+    int result = msf_gif_end_to_file(&recorder->state);
+    fclose(recorder->file);
+
+    if (result != 0) TRACELOG(LOG_INFO, "SYSTEM: Animated GIF recording saved successfully");
+    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to save animated GIF recording");
+
+    RL_FREE(recorder);
+}
+
+// Queue GIF frame for encoding, takes ownership of pixels
+static void PushGifFrame(unsigned char *pixels, int pitch)
+{
+    GifFrame *frame = (GifFrame *)RL_MALLOC(sizeof(GifFrame));
+    frame->recorder = gifRecorder;
+    frame->pixels = pixels;
+    frame->pitch = pitch;
+
+    PushCaptureJob(EncodeGifFrame, frame);
+}
+
+// Retrieve pending GIF frame readback from pixel buffer and queue it for encoding
+// NOTE: Readback was requested GIF_RECORD_FRAMERATE frames ago, mapping should not stall
+static void PushGifPixelBufferFrame(void)
+{
+    int size = gifRecorder->width*gifRecorder->height*4;
+    unsigned char *data = (unsigned char *)rlMapPixelBuffer(gifPixelBuffer, size);
+
+    if (data != NULL)
+    {
+        unsigned char *pixels = (unsigned char *)RL_MALLOC(size);
+        memcpy(pixels, data, size);
+        rlUnmapPixelBuffer(gifPixelBuffer);
+
+        // NOTE: Pixel buffer rows are bottom-up, negative pitch flips them while encoding
+        PushGifFrame(pixels, -gifRecorder->width*4);
+    }
+    else
+    {
+        // Mapping not supported, fallback to synchronous readback for next frames
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to map GIF recording pixel buffer, using synchronous readback");
+        rlUnloadPixelBuffer(gifPixelBuffer);
+        gifPixelBuffer = 0;
+    }
+
+    gifPixelBufferPending = false;
+}
+
+// Start GIF recording, frames streamed to file
+static void StartGifRecording(void)
+{
+    Vector2 scale = GetWindowScaleDPI();
+    int width = (int)((float)CORE.Window.render.width*scale.x);
+    int height = (int)((float)CORE.Window.render.height*scale.y);
+
+    screenshotCounter++;
+    const char *fileName = TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter);
+
+    FILE *file = fopen(fileName, "wb");
+
+    if (file == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file for animated GIF recording", fileName);
+        return;
+    }
+
+    gifRecorder = (GifRecorder *)RL_CALLOC(1, sizeof(GifRecorder));
+    gifRecorder->file = file;
+    gifRecorder->width = width;
+    gifRecorder->height = height;
+    msf_gif_begin_to_file(&gifRecorder->state, width, height, (MsfGifFileWriteFunc)fwrite, (void *)file);
+
+    InitCaptureWorker();
+    gifPixelBuffer = rlLoadPixelBuffer(width*height*4);
+    gifPixelBufferPending = false;
+
+    gifRecording = true;
+    gifFrameCounter = 0;
+
+    TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
+}
+
+// Stop GIF recording, file completed by capture worker
+static void StopGifRecording(void)
+{
+    if (gifPixelBufferPending) PushGifPixelBufferFrame();
+
+    if (gifPixelBuffer != 0)
+    {
+        rlUnloadPixelBuffer(gifPixelBuffer);
+        gifPixelBuffer = 0;
+    }
+
+    PushCaptureJob(FinishGifRecording, gifRecorder);
+
+    gifRecorder = NULL;
+    gifRecording = false;
+
+    TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
+}
+
+// Capture current frame for GIF recording
+// NOTE: Frame pixels are read asynchronously if pixel buffers are supported, previous
+// frame readback is retrieved and queued, encoding is done on capture worker
+static void CaptureGifFrame(void)
+{
+    if (gifPixelBufferPending) PushGifPixelBufferFrame();
+
+    if (gifPixelBuffer != 0)
+    {
+        rlReadScreenPixelsToBuffer(gifPixelBuffer, gifRecorder->width, gifRecorder->height);
+        gifPixelBufferPending = true;
+    }
+    else PushGifFrame(rlReadScreenPixels(gifRecorder->width, gifRecorder->height), gifRecorder->width*4);
+}
+#endif  // SUPPORT_GIF_RECORDING
+
+#if defined(SUPPORT_COMPRESSION_API)
+// Get compressed data maximum size (CompressDataBlock() output)
+// NOTE: Worst case is stored blocks, sdefl splits data in SDEFL_BLK_MAX blocks and every block in stored
+// blocks of SDEFL_RAW_BLK_SIZE (5 bytes header each), dynamic blocks are only used if smaller,
+// sdefl_bound() does not consider blocks split so it's not used
+static int GetCompressDataBound(int size)
+{
+    int blockCount = size/SDEFL_BLK_MAX + 1;
+
+    return (size + blockCount*(5*(SDEFL_BLK_MAX/SDEFL_RAW_BLK_SIZE + 1) + 8) + 16);
+}
+
+// Compress data range [start, end) as raw DEFLATE blocks, data before start (up to 32KB) is used as matches window
+// NOTE: Same compression as sdeflate(), output starts byte aligned and, if not last, it ends
+// with a sync flush (empty stored block) so it is byte aligned for next data range
+static int CompressDataBlock(struct sdefl *sdefl, const unsigned char *data, int start, int end, int level, bool last, unsigned char *output)
+{
+    static const unsigned char niceLengths[SDEFL_LVL_MAX + 1] = { 8, 10, 14, 24, 30, 48, 65, 96, 130 };
+
+    unsigned char *out = output;
+    int maxChain = (level < 8)? (1 << (level + 1)) : (1 << 13);
+    int literals = 0;
+
+    sdefl->bits = 0;
+    sdefl->bitcnt = 0;
+    sdefl->seq_cnt = 0;
+    memset(&sdefl->freq, 0, sizeof(sdefl->freq));
+    for (int i = 0; i < SDEFL_HASH_SIZ; i++) sdefl->tbl[i] = SDEFL_NIL;
+
+    // Insert matches window data, decoder has it as previous output
+    for (int i = (start > SDEFL_WIN_SIZ)? (start - SDEFL_WIN_SIZ) : 0; (i < start) && ((end - i) > SDEFL_MIN_MATCH); i++)
+    {
+        unsigned int hash = sdefl_hash32(&data[i]);
+        sdefl->prv[i & SDEFL_WIN_MSK] = sdefl->tbl[hash];
+        sdefl->tbl[hash] = i;
+    }
+
+    if (start == end)
+    {
+        // Empty data, sdefl_flush() would skip it as an empty stored block
+        if (last)
+        {
+            sdefl_put(&out, sdefl, 1, 1);       // Last block
+            sdefl_put(&out, sdefl, 1, 2);       // Fixed Huffman codes block
+            sdefl_put(&out, sdefl, 0, 7);       // End of block code
+        }
+    }
+
+    for (int i = start; i < end; )
+    {
+        int blockStart = i;
+        int blockEnd = ((end - i) > SDEFL_BLK_MAX)? (i + SDEFL_BLK_MAX) : end;
+
+        while (i < blockEnd)
+        {
+            struct sdefl_match match = { 0 };
+            int left = blockEnd - i;
+            int maxLength = (left > SDEFL_MAX_MATCH)? SDEFL_MAX_MATCH : left;
+            int niceLength = (niceLengths[level] < maxLength)? niceLengths[level] : maxLength;
+            int run = 1;
+            int step = 1;
+
+            if (maxLength > SDEFL_MIN_MATCH) sdefl_fnd(&match, sdefl, maxChain, maxLength, data, i, end);
+
+            if ((level >= 5) && (match.len >= SDEFL_MIN_MATCH) && ((match.len + 1) < niceLength))
+            {
+                struct sdefl_match next = { 0 };
+                sdefl_fnd(&next, sdefl, maxChain, match.len + 1, data, i + 1, end);
+                if (next.len > match.len) match.len = 0;
+            }
+
+            if (match.len >= SDEFL_MIN_MATCH)
+            {
+                if (literals > 0)
+                {
+                    sdefl_seq(sdefl, i - literals, literals);
+                    literals = 0;
+                }
+
+                sdefl_seq(sdefl, -match.off, match.len);
+                sdefl_reg_match(sdefl, match.off, match.len);
+
+                if ((level < 2) && (match.len >= niceLength)) step = match.len;
+                else run = match.len;
+            }
+            else
+            {
+                sdefl->freq.lit[data[i]]++;
+                literals++;
+            }
+
+            if ((end - (i + run*step)) > SDEFL_MIN_MATCH)
+            {
+                while (run-- > 0)
+                {
+                    unsigned int hash = sdefl_hash32(&data[i]);
+                    sdefl->prv[i & SDEFL_WIN_MSK] = sdefl->tbl[hash];
+                    sdefl->tbl[hash] = i;
+                    i += step;
+                }
+            }
+            else i += run*step;
+        }
+
+        if (literals > 0)
+        {
+            sdefl_seq(sdefl, i - literals, literals);
+            literals = 0;
+        }
+
+        sdefl_flush(&out, sdefl, (last && (blockEnd == end)), data, blockStart, blockEnd);
+    }
+
+    if (!last)
+    {
+        // Sync flush: empty stored block, aligned to byte boundary
+        sdefl_put(&out, sdefl, 0, 3);
+        if (sdefl->bitcnt > 0) sdefl_put(&out, sdefl, 0, 8 - sdefl->bitcnt);
+        sdefl_put16(&out, 0x0000);
+        sdefl_put16(&out, 0xffff);
+    }
+    else if (sdefl->bitcnt > 0) sdefl_put(&out, sdefl, 0, 8 - sdefl->bitcnt);
+
+    return (int)(out - output);
+}
+
+// Compress data block, task callback
+static void CompressDataTask(void *data, int index)
+{
+    CompressTask *task = (CompressTask *)data;
+    int start = index*COMPRESSION_TASK_BLOCK_SIZE;
+    int end = (index == (task->blockCount - 1))? task->dataSize : (start + COMPRESSION_TASK_BLOCK_SIZE);
+
+    struct sdefl *sdefl = (struct sdefl *)RL_MALLOC(sizeof(struct sdefl));
+    task->blocks[index] = (unsigned char *)RL_MALLOC(GetCompressDataBound(end - start));
+    task->blockSizes[index] = CompressDataBlock(sdefl, task->data, start, end, COMPRESSION_LEVEL_DEFAULT, (index == (task->blockCount - 1)), task->blocks[index]);
+
+    RL_FREE(sdefl);
+}
+
+// Get input bits from decompression stream (LSB first), up to 32 bits
+// NOTE: If input data is not enough, inputEnded is set and current step must be undone
+static inline unsigned int GetInflateBits(DecompressStream *stream, int count)
+{
+    while ((stream->bitCount < count) && (stream->inputPosition < stream->inputSize))
+    {
+        stream->bitBuffer |= (unsigned long long)stream->input[stream->inputPosition++] << stream->bitCount;
+        stream->bitCount += 8;
+    }
+
+    if (stream->bitCount < count)
+    {
+        stream->inputEnded = true;
+        return 0;
+    }
+
+    unsigned int bits = (unsigned int)(stream->bitBuffer & ((1ull << count) - 1));
+    stream->bitBuffer >>= count;
+    stream->bitCount -= count;
+
+    return bits;
+}
+
+// Decode Huffman coded symbol from decompression stream, returns -1 on invalid code
+static inline int DecodeInflateSymbol(DecompressStream *stream, const InflateTable *table)
+{
+    // Fill bits buffer, at least 15 bits (maximum code length) if input available
+    while ((stream->bitCount <= 56) && (stream->inputPosition < stream->inputSize))
+    {
+        stream->bitBuffer |= (unsigned long long)stream->input[stream->inputPosition++] << stream->bitCount;
+        stream->bitCount += 8;
+    }
+
+    int entry = table->fast[stream->bitBuffer & ((1 << INFLATE_FAST_BITS) - 1)];
+
+    if (entry != 0)
+    {
+        int length = entry & 15;
+
+        if (length > stream->bitCount)
+        {
+            stream->inputEnded = true;
+            return 0;
+        }
+
+        stream->bitBuffer >>= length;
+        stream->bitCount -= length;
+
+        return (entry >> 4);
+    }
+
+    // Canonical decoding, bit by bit, for codes longer than fast lookup
+    int code = 0;
+    int first = 0;
+    int index = 0;
+
+    for (int length = 1; length < 16; length++)
+    {
+        if (length > stream->bitCount)
+        {
+            stream->inputEnded = true;
+            return 0;
+        }
+
+        code |= (int)((stream->bitBuffer >> (length - 1)) & 1);
+        int count = table->counts[length];
+
+        if ((code - first) < count)
+        {
+            stream->bitBuffer >>= length;
+            stream->bitCount -= length;
+
+            return table->symbols[index + code - first];
+        }
+
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    return -1;
+}
+
+// Build Huffman decoding table from codes lengths, returns false if codes are invalid
+static bool BuildInflateTable(InflateTable *table, const unsigned char *lengths, int count)
+{
+    unsigned short offsets[16] = { 0 };
+
+    memset(table->counts, 0, sizeof(table->counts));
+    for (int i = 0; i < count; i++) table->counts[lengths[i]]++;
+    table->counts[0] = 0;
+
+    // Check codes are not over-subscribed (incomplete codes are allowed)
+    int left = 1;
+    for (int length = 1; length < 16; length++)
+    {
+        left = (left << 1) - table->counts[length];
+        if (left < 0) return false;
+    }
+
+    for (int length = 1; length < 15; length++) offsets[length + 1] = offsets[length] + table->counts[length];
+    for (int i = 0; i < count; i++) if (lengths[i] != 0) table->symbols[offsets[lengths[i]]++] = (unsigned short)i;
+
+    // Fill fast lookup with bit-reversed codes, every entry matching code bits
+    memset(table->fast, 0, sizeof(table->fast));
+
+    int code = 0;
+    int index = 0;
+
+    for (int length = 1; length <= INFLATE_FAST_BITS; length++)
+    {
+        for (int i = 0; i < table->counts[length]; i++, code++)
+        {
+            int reversed = 0;
+            for (int b = 0; b < length; b++) reversed |= ((code >> b) & 1) << (length - 1 - b);
+
+            for (int k = reversed; k < (1 << INFLATE_FAST_BITS); k += (1 << length)) table->fast[k] = (unsigned short)((table->symbols[index] << 4) | length);
+            index++;
+        }
+
+        code <<= 1;
+    }
+
+    return true;
+}
+
+// Read dynamic Huffman block codes from decompression stream, returns false if codes are invalid
+static bool ReadInflateCodes(DecompressStream *stream)
+{
+    static const unsigned char order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+    unsigned char lengths[288 + 32] = { 0 };
+    int literalCount = GetInflateBits(stream, 5) + 257;
+    int distanceCount = GetInflateBits(stream, 5) + 1;
+    int codeCount = GetInflateBits(stream, 4) + 4;
+
+    for (int i = 0; i < codeCount; i++) lengths[order[i]] = (unsigned char)GetInflateBits(stream, 3);
+    if (stream->inputEnded) return true;
+    if ((literalCount > 286) || (distanceCount > 30) || !BuildInflateTable(&stream->literals, lengths, 19)) return false;
+
+    // NOTE: Code lengths codes decoded with literals table, rebuilt after
+    memset(lengths, 0, 19);
+
+    for (int i = 0; i < (literalCount + distanceCount); )
+    {
+        int symbol = DecodeInflateSymbol(stream, &stream->literals);
+        int repeat = 0;
+        int length = 0;
+
+        if (stream->inputEnded) return true;
+        if (symbol < 0) return false;
+
+        if (symbol < 16) { lengths[i++] = (unsigned char)symbol; continue; }
+        else if (symbol == 16)
+        {
+            if (i == 0) return false;
+            length = lengths[i - 1];
+            repeat = 3 + GetInflateBits(stream, 2);
+        }
+        else if (symbol == 17) repeat = 3 + GetInflateBits(stream, 3);
+        else repeat = 11 + GetInflateBits(stream, 7);
+
+        if (stream->inputEnded) return true;
+        if ((i + repeat) > (literalCount + distanceCount)) return false;
+
+        while (repeat-- > 0) lengths[i++] = (unsigned char)length;
+    }
+
+    if (lengths[256] == 0) return false;    // End of block code required
+
+    return (BuildInflateTable(&stream->literals, lengths, literalCount) && BuildInflateTable(&stream->distances, lengths + literalCount, distanceCount));
+}
+
+// Decode DEFLATE data from stream input, returns decoding state
+// NOTE: Decoding stops when input data ends or output limit is reached (state is kept, unless outputLimitFails),
+// when stream is finished or on failure
+static int InflateData(DecompressStream *stream)
+{
+    static const unsigned short lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const unsigned char lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const unsigned short distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const unsigned char distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    while ((stream->state != INFLATE_FINISHED) && (stream->state != INFLATE_FAILED))
+    {
+        // Step start, restored if input data ends in the middle of the step
+        int inputPosition = stream->inputPosition;
+        unsigned long long bitBuffer = stream->bitBuffer;
+        int bitCount = stream->bitCount;
+        int state = stream->state;
+
+        // Make room for step output: a stored data chunk or a match
+        if ((stream->outputCapacity - stream->outputSize) < SDEFL_MAX_MATCH)
+        {
+            if (stream->outputCapacity >= stream->outputLimit)
+            {
+                if (stream->outputLimitFails) stream->state = INFLATE_FAILED;
+                break;
+            }
+
+            stream->outputCapacity = ((stream->outputLimit/2) > stream->outputCapacity)? 2*stream->outputCapacity : stream->outputLimit;
+            stream->output = (unsigned char *)RL_REALLOC(stream->output, stream->outputCapacity);
+        }
+
+        if (stream->state == INFLATE_BLOCK_HEADER)
+        {
+            stream->lastBlock = GetInflateBits(stream, 1);
+            int type = GetInflateBits(stream, 2);
+
+            if (type == 0)
+            {
+                // Stored block: skip to byte boundary, read length and its complement
+                GetInflateBits(stream, stream->bitCount & 7);
+                unsigned int length = GetInflateBits(stream, 16);
+                unsigned int complement = GetInflateBits(stream, 16);
+
+                if (!stream->inputEnded && (length != (~complement & 0xffff))) stream->state = INFLATE_FAILED;
+                else
+                {
+                    stream->storedSize = length;
+                    stream->state = INFLATE_BLOCK_STORED;
+                }
+            }
+            else if (type == 1)
+            {
+                unsigned char lengths[288 + 32] = { 0 };
+                for (int i = 0; i < 144; i++) lengths[i] = 8;
+                for (int i = 144; i < 256; i++) lengths[i] = 9;
+                for (int i = 256; i < 280; i++) lengths[i] = 7;
+                for (int i = 280; i < 288; i++) lengths[i] = 8;
+                for (int i = 288; i < 288 + 32; i++) lengths[i] = 5;
+
+                if (!stream->inputEnded)
+                {
+                    BuildInflateTable(&stream->literals, lengths, 288);
+                    BuildInflateTable(&stream->distances, lengths + 288, 32);
+                    stream->state = INFLATE_BLOCK_HUFFMAN;
+                }
+            }
+            else if (type == 2)
+            {
+                if (!ReadInflateCodes(stream)) stream->state = INFLATE_FAILED;
+                else stream->state = INFLATE_BLOCK_HUFFMAN;
+            }
+            else if (!stream->inputEnded) stream->state = INFLATE_FAILED;
+        }
+        else if (stream->state == INFLATE_BLOCK_STORED)
+        {
+            // NOTE: Stored data is copied as available, bytes already in bits buffer first
+            int size = stream->outputCapacity - stream->outputSize;
+            if (size > stream->storedSize) size = stream->storedSize;
+
+            for (; (size > 0) && (stream->bitCount >= 8); size--)
+            {
+                stream->output[stream->outputSize++] = (unsigned char)stream->bitBuffer;
+                stream->bitBuffer >>= 8;
+                stream->bitCount -= 8;
+                stream->storedSize--;
+            }
+
+            if (size > (stream->inputSize - stream->inputPosition)) size = stream->inputSize - stream->inputPosition;
+
+            memcpy(stream->output + stream->outputSize, stream->input + stream->inputPosition, size);
+            stream->outputSize += size;
+            stream->inputPosition += size;
+            stream->storedSize -= size;
+
+            if (stream->storedSize == 0) stream->state = stream->lastBlock? INFLATE_FINISHED : INFLATE_BLOCK_HEADER;
+            else if (stream->inputPosition == stream->inputSize) break;
+        }
+        else
+        {
+            int symbol = DecodeInflateSymbol(stream, &stream->literals);
+
+            if (stream->inputEnded) { }
+            else if ((symbol < 0) || (symbol > 285)) stream->state = INFLATE_FAILED;
+            else if (symbol < 256) stream->output[stream->outputSize++] = (unsigned char)symbol;
+            else if (symbol == 256) stream->state = stream->lastBlock? INFLATE_FINISHED : INFLATE_BLOCK_HEADER;
+            else
+            {
+                symbol -= 257;
+                int length = lengthBase[symbol] + GetInflateBits(stream, lengthExtra[symbol]);
+                int distanceSymbol = DecodeInflateSymbol(stream, &stream->distances);
+
+                if (stream->inputEnded) { }
+                else if ((distanceSymbol < 0) || (distanceSymbol > 29)) stream->state = INFLATE_FAILED;
+                else
+                {
+                    int distance = distanceBase[distanceSymbol] + GetInflateBits(stream, distanceExtra[distanceSymbol]);
+
+                    if (stream->inputEnded) { }
+                    else if (distance > stream->outputSize) stream->state = INFLATE_FAILED;
+                    else
+                    {
+                        unsigned char *dst = stream->output + stream->outputSize;
+                        const unsigned char *src = dst - distance;
+
+                        if (distance >= length) memcpy(dst, src, length);
+                        else
+                        {
+                            // Overlapped match repeats distance bytes pattern, copied doubling copy size
+                            memcpy(dst, src, distance);
+
+                            for (int copied = distance; copied < length; )
+                            {
+                                int size = ((length - copied) < copied)? (length - copied) : copied;
+                                memcpy(dst + copied, dst, size);
+                                copied += size;
+                            }
+                        }
+
+                        stream->outputSize += length;
+                    }
+                }
+            }
+        }
+
+        // Input data ended, undo step and wait for more data
+        if (stream->inputEnded)
+        {
+            stream->inputEnded = false;
+            stream->inputPosition = inputPosition;
+            stream->bitBuffer = bitBuffer;
+            stream->bitCount = bitCount;
+            stream->state = state;
+            break;
+        }
+    }
+
+    return stream->state;
+}
+#endif  // SUPPORT_COMPRESSION_API
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
@@ -13,6 +13,10 @@
 *       When an internal state change is required all the stored vertex data is renderer in batch,
 *       additionally, rlDrawRenderBatchActive() could be called to force flushing of the batch.
 *
+*       Optionally, rlEnableRenderBatchSorting() defers shader and blend mode changes into the batch,
+*       draw calls are sorted by state (layer, shader, blend mode, texture) and merged on flush,
+*       submission order is only kept between layers, defined with rlSetRenderBatchLayer()
+*
 *       Some resources are also loaded for convenience, here the complete list:
 *          - Default batch (RLGL.defaultBatch): RenderBatch system to accumulate vertex data
 *          - Default texture (RLGL.defaultTextureId): 1x1 white pixel R8G8B8A8
@@ -31,6 +35,12 @@
 *           Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *           required by any other module, use rlGetVersion() to check it
 *
+*       #define GRAPHICS_API_NULL
+*           Use null graphics backend, no OpenGL context required: full OpenGL 3.3 pipeline (batching,
+*           shaders, textures) runs on CPU but every OpenGL command is only recorded into an in-memory
+*           command log (rlGetNullCommands()) with statistics and bytes uploaded (rlGetNullStats()),
+*           useful for headless testing and benchmarking, rlLoadExtensions() loader is ignored
+*
 *       #define RLGL_IMPLEMENTATION
 *           Generates the implementation of the library into the included file.
 *           If not defined, the library is in header only mode and can be included in other headers
@@ -46,6 +56,23 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_ENABLE_BATCH_STREAMING
+*           Stream render batch vertex data through a ring of RL_DEFAULT_BATCH_BUFFERS buffers:
+*           persistent-mapped buffers + fences if GL_ARB_buffer_storage (OpenGL 4.4) is available,
+*           buffer orphaning otherwise, so batch uploads never wait for the GPU (no implicit syncs)
+*           NOTE: Requires RL_DEFAULT_BATCH_BUFFERS > 1 to avoid waiting on every flush (3 by default)
+*
+*       #define RLGL_ENABLE_BATCH_INTERLEAVED
+*           Store render batch vertex data interleaved (position + texcoord + color, rlBatchVertex)
+*           in a single vertex buffer instead of one array/buffer per attribute, every rlVertex*()
+*           writes one contiguous vertex and every batch draw requires a single upload
+*
+*       #define RLGL_ENABLE_BATCH_TEXTURE_SLOTS
+*           Default shader samples up to RL_DEFAULT_BATCH_TEXTURE_SLOTS textures selected by a per-vertex
+*           texture slot, rlSetTexture() only starts a new draw call when all slots are in use
+*           NOTE: Only available on OpenGL 3.3+, OpenGL 2.1 and ES 2.0 keep one texture per draw call
+*           NOTE: Shaders loaded with custom vertex shader and no fragment shader use a single texture0 default fragment shader
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
@@ -53,9 +80,11 @@
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*       #define RL_DEFAULT_BATCH_TEXTURE_SLOTS        8    // Maximum number of textures sampled by default shader per draw call (RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_SHADER_UNIFORM_MATRICES      128    // Maximum number of matrices set in a uniform array (bone matrices)
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -68,12 +97,15 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: 3
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: 4
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: 6
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: 7
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL       "matModel"          // model matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL      "matNormal"         // normal matrix (transpose(inverse(matModelView))
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
+*       #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES "boneMatrices"    // bone matrices array (skinning)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
@@ -144,6 +176,18 @@
     #define RL_FREE(p)        free(p)
 #endif
 
+// Null backend runs OpenGL 3.3 Core code path with recording functions instead of OpenGL
+#if defined(GRAPHICS_API_NULL)
+    #undef GRAPHICS_API_OPENGL_11
+    #undef GRAPHICS_API_OPENGL_21
+    #undef GRAPHICS_API_OPENGL_43
+    #undef GRAPHICS_API_OPENGL_ES2
+    #undef GRAPHICS_API_OPENGL_ES3
+    #if !defined(GRAPHICS_API_OPENGL_33)
+        #define GRAPHICS_API_OPENGL_33
+    #endif
+#endif
+
 // Security check in case no GRAPHICS_API_OPENGL_* defined
 #if !defined(GRAPHICS_API_OPENGL_11) && \
     !defined(GRAPHICS_API_OPENGL_21) && \
@@ -186,6 +230,11 @@
     #define GRAPHICS_API_OPENGL_ES2
 #endif
 
+// Batch texture slots require GLSL 3.30 (flat integer varyings), not available on OpenGL 1.1, 2.1 and ES 2.0
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS) && (!defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_21))
+    #undef RLGL_ENABLE_BATCH_TEXTURE_SLOTS
+#endif
+
 // Support framebuffer objects by default
 // NOTE: Some driver implementation do not support it, despite they should
 #define RLGL_RENDER_TEXTURES_HINT
@@ -209,7 +258,11 @@
     #endif
 #endif
 #ifndef RL_DEFAULT_BATCH_BUFFERS
-    #define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
+    #if defined(RLGL_ENABLE_BATCH_STREAMING)
+        #define RL_DEFAULT_BATCH_BUFFERS             3      // Default number of batch buffers (ring, GPU reads one while CPU writes next)
+    #else
+        #define RL_DEFAULT_BATCH_BUFFERS             1      // Default number of batch buffers (multi-buffering)
+    #endif
 #endif
 #ifndef RL_DEFAULT_BATCH_DRAWCALLS
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
@@ -217,6 +270,9 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_TEXTURE_SLOTS
+    #define RL_DEFAULT_BATCH_TEXTURE_SLOTS           8      // Maximum number of textures sampled by default shader per draw call (up to 16)
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -227,6 +283,14 @@
 #ifndef RL_MAX_SHADER_LOCATIONS
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
+#ifndef RL_MAX_SHADER_UNIFORM_MATRICES
+    #define RL_MAX_SHADER_UNIFORM_MATRICES         128      // Maximum number of matrices set in a uniform array (bone matrices)
+#endif
+
+// Default shader vertex attributes locations (skinning)
+// NOTE: OpenGL ES 2.0 and WebGL only guarantee 8 vertex attributes (locations 0..7)
+#define RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS        6  // Mesh vertex bone ids attribute location
+#define RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS    7  // Mesh vertex bone weights attribute location
 
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
@@ -340,13 +404,32 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+// Interleaved batch vertex (position + texcoords + color)
+typedef struct rlBatchVertex {
+    float x, y, z;              // Vertex position (shader-location = 0)
+    float u, v;                 // Vertex texture coordinates (shader-location = 1)
+    unsigned char r, g, b, a;   // Vertex color (shader-location = 3)
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    float slot;                 // Vertex texture slot (shader-location = 8)
+#endif
+} rlBatchVertex;
+#endif
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+    rlBatchVertex *data;        // Vertex data interleaved (position + texcoords + color, 4 vertex per quad) (shader-location = 0, 1, 3)
+#else
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    float *texslots;            // Vertex texture slots (1 component per vertex) (shader-location = 8)
+#endif
+#endif
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -354,7 +437,14 @@ typedef struct rlVertexBuffer {
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (4 types of vertex data + texture slots)
+#else
     unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+#endif
+
+    bool mapped;                // Vertex arrays point to persistent-mapped GPU memory (RLGL_ENABLE_BATCH_STREAMING)
+    void *fence;                // GPU fence (GLsync) for the last draw reading this buffer (RLGL_ENABLE_BATCH_STREAMING)
 } rlVertexBuffer;
 
 // Draw call type
@@ -365,9 +455,17 @@ typedef struct rlDrawCall {
     int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
     int vertexCount;            // Number of vertex of the draw
     int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
+    int vertexOffset;           // Vertex offset of the draw in the vertex buffer (computed on batch sorting)
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
-    //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
+    unsigned int shaderId;      // Shader id to be used on the draw -> Only used on batch sorting
+    int *shaderLocs;            // Shader locations to be used on the draw -> Only used on batch sorting
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    unsigned int textureSlots[RL_DEFAULT_BATCH_TEXTURE_SLOTS];  // Texture ids sampled by the draw, selected by vertex texture slot
+    int textureSlotCount;       // Number of texture slots in use
+#endif
+    int blendMode;              // Blending mode to be used on the draw -> Only used on batch sorting
+    int layer;                  // Layer of the draw, sorting never moves draws between layers -> Only used on batch sorting
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -384,6 +482,44 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+#if defined(GRAPHICS_API_NULL)
+// Null backend command types
+typedef enum {
+    RL_NULL_COMMAND_STATE = 0,  // State change (bind, enable, blend, viewport...)
+    RL_NULL_COMMAND_RESOURCE,   // Resource creation/destruction (buffers, textures, shaders...)
+    RL_NULL_COMMAND_UPLOAD,     // Data upload to GPU (buffer data, texture data, uniforms...)
+    RL_NULL_COMMAND_DRAW,       // Draw call (draw arrays/elements, clear, blit)
+    RL_NULL_COMMAND_READBACK,   // Data readback from GPU (read pixels, texture data)
+    RL_NULL_COMMAND_QUERY,      // State query (get integer, locations, status)
+    RL_NULL_COMMAND_FLUSH       // Render batch flush marker (rlDrawRenderBatch() with vertex data)
+} rlNullCommandType;
+
+// Null backend recorded command
+typedef struct rlNullCommand {
+    int type;                   // Command type (rlNullCommandType)
+    const char *name;           // OpenGL function name (static string)
+    unsigned int param;         // Main command parameter (object id, target, mode, location...)
+    int count;                  // Elements count (vertex/index count for draws, objects, uniform values)
+    int bytes;                  // Bytes transferred (uploads/readbacks)
+} rlNullCommand;
+
+// Null backend statistics, accumulated since last rlResetNullCommands()
+typedef struct rlNullStats {
+    int commands;               // Total commands recorded (including the ones not stored in log)
+    int stateChanges;           // State change commands
+    int resources;              // Resource creation/destruction commands
+    int uploads;                // Upload commands
+    long long uploadBytes;      // Total bytes uploaded
+    int drawCalls;              // Draw commands
+    long long drawElements;     // Total vertex/index count drawn
+    int readbacks;              // Readback commands
+    long long readbackBytes;    // Total bytes read back
+    int queries;                // Query commands
+    int flushes;                // Render batch flushes
+    long long batchVertices;    // Total vertices flushed by render batch
+} rlNullStats;
+#endif
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -677,6 +813,9 @@ RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);                         // D
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch);                    // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);                                   // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
+RLAPI void rlEnableRenderBatchSorting(void);                                // Enable render batch draw calls sorting and merging by state on flush
+RLAPI void rlDisableRenderBatchSorting(void);                               // Disable render batch draw calls sorting (draw calls submitted in order)
+RLAPI void rlSetRenderBatchLayer(int layer);                                // Set render batch layer for next draws (lower layers drawn first on sorting)
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
@@ -709,6 +848,11 @@ RLAPI void rlUnloadTexture(unsigned int id);                              // Unl
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format);              // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI unsigned int rlLoadPixelBuffer(int size);                           // Load pixel buffer for asynchronous readback (returns 0 if not supported)
+RLAPI void rlUnloadPixelBuffer(unsigned int id);                          // Unload pixel buffer from GPU memory
+RLAPI void rlReadScreenPixelsToBuffer(unsigned int id, int width, int height); // Read screen pixel data into pixel buffer (asynchronous, RGBA, not flipped)
+RLAPI void *rlMapPixelBuffer(unsigned int id, int size);                  // Map pixel buffer data for reading (waits for readback to complete)
+RLAPI void rlUnmapPixelBuffer(unsigned int id);                           // Unmap pixel buffer data
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
@@ -725,6 +869,7 @@ RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName);
 RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute
 RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count);   // Set shader value uniform
 RLAPI void rlSetUniformMatrix(int locIndex, Matrix mat);                        // Set shader value matrix
+RLAPI void rlSetUniformMatrices(int locIndex, const Matrix *mats, int count);   // Set shader value matrices array
 RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
 RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
 
@@ -759,6 +904,13 @@ RLAPI void rlSetMatrixViewOffsetStereo(Matrix right, Matrix left);        // Set
 RLAPI void rlLoadDrawCube(void);     // Load and draw a cube
 RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 
+#if defined(GRAPHICS_API_NULL)
+// Null backend recorded commands inspection
+RLAPI const rlNullCommand *rlGetNullCommands(int *count);                 // Get recorded commands log (up to RL_NULL_MAX_COMMANDS)
+RLAPI rlNullStats rlGetNullStats(void);                                   // Get recorded commands statistics
+RLAPI void rlResetNullCommands(void);                                     // Reset recorded commands log and statistics
+#endif
+
 #if defined(__cplusplus)
 }
 #endif
@@ -929,6 +1081,24 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: 8 (RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+#endif
+// NOTE: Batch texture slot location is not used by any mesh attribute (OpenGL 3.3 guarantees 16 vertex attributes),
+// it's only provided by render batch and it's not exposed as a shader location (SHADER_LOC_*)
+#define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT   8   // Batch texture slot attribute location
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: 6
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: 7
+#endif
+
+#if defined(GRAPHICS_API_NULL)
+    #ifndef RL_NULL_MAX_COMMANDS
+        #define RL_NULL_MAX_COMMANDS               65536    // Maximum number of commands stored in null backend log (statistics keep counting)
+    #endif
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -948,6 +1118,9 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
 #endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES "boneMatrices"    // bone matrices array (skinning)
+#endif
 #ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 #endif
@@ -983,13 +1156,23 @@ typedef struct rlglData {
 
         unsigned int defaultTextureId;      // Default texture used on shapes/poly drawing (required by shader)
         unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];    // Active texture ids to be enabled on batch drawing (0 active by default)
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+        int textureSlot;                    // Current active texture slot (added on glVertex*())
+        int batchTextureSlots;              // Texture slots available on default shader (limited by GL_MAX_TEXTURE_IMAGE_UNITS)
+#endif
         unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program)
         unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program)
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+        unsigned int defaultSingleFShaderId;// Default fragment shader id sampling single texture0 (used with custom vertex shaders)
+#endif
         unsigned int defaultShaderId;       // Default shader program id, supports vertex color and diffuse texture
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
 
+        bool batchSorting;                  // Render batch draw calls sorting by state enabled
+        int batchLayer;                     // Render batch layer for next draws (sorting keeps layers order)
+
         bool stereoRender;                  // Stereo rendering flag
         Matrix projectionStereo[2];         // VR stereo rendering eyes projection matrices
         Matrix viewOffsetStereo[2];         // VR stereo rendering eyes view offset matrices
@@ -1028,6 +1211,7 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Persistent-mapped buffers support (GL_ARB_buffer_storage)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -1037,6 +1221,17 @@ typedef struct rlglData {
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
 
+#if defined(GRAPHICS_API_NULL)
+typedef struct rlNullData {
+    rlNullCommand *commands;            // Recorded commands log
+    int commandCount;                   // Recorded commands in log
+    int capacity;                       // Recorded commands log capacity
+    rlNullStats stats;                  // Recorded commands statistics
+    unsigned int objectCounter;         // Generated objects ids counter
+    int locationCounter;                // Generated uniform locations counter
+} rlNullData;
+#endif
+
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 //----------------------------------------------------------------------------------
@@ -1046,6 +1241,10 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 static rlglData RLGL = { 0 };
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_NULL)
+static rlNullData RLNULL = { 0 };
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
 // NOTE: VAO functionality is exposed through extensions (OES)
 static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays = NULL;
@@ -1070,6 +1269,30 @@ static const char *rlGetCompressedFormatName(int format); // Get compressed form
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void *rlMapBufferPersistent(int size);               // Allocate bound array buffer storage and map it persistently
+static void rlLoadBatchVertexArrays(rlVertexBuffer *buffer, int bufferElements);    // Load batch vertex arrays in CPU memory (RAM)
+#if defined(RLGL_ENABLE_BATCH_STREAMING) && defined(GRAPHICS_API_OPENGL_33)
+static bool rlIsBatchVertexBufferMapped(const rlVertexBuffer *buffer);              // Check all batch vertex arrays got a persistent mapping
+#endif
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+static void rlSetBatchVertexAttributes(void);               // Set interleaved batch vertex attributes for bound array buffer
+#endif
+static void rlApplyBlendMode(int mode);                     // Apply blend mode to OpenGL state
+static void rlAddBatchDrawCall(void);                       // Close current batch draw call and start a new one with current state
+static int rlCompareDrawCalls(const rlDrawCall *a, const rlDrawCall *b);    // Compare draw calls by state
+static void rlSortRenderBatchDraws(rlRenderBatch *batch);   // Sort render batch draw calls by state
+static void rlDrawRenderBatchSorted(rlRenderBatch *batch, const float *matMVP);    // Draw sorted render batch draw calls, merging by state
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+static void rlResetBatchTextureSlots(rlDrawCall *draw);     // Reset draw call texture slots to draw call texture
+static int rlAddBatchTextureSlot(unsigned int id);          // Get texture slot for texture on current draw call, adding it if required
+static void rlBindBatchTextureSlots(const rlDrawCall *draw);    // Bind draw call texture slots to their texture units
+#endif
+#endif
+#if defined(GRAPHICS_API_NULL)
+static void rlNullRecord(int type, const char *name, unsigned int param, int count, int bytes);  // Record command into null backend log
+static void rlLoadNullFunctions(void);                      // Load null backend recording functions into OpenGL function pointers
+#endif
 
 // Auxiliar matrix math functions
 static Matrix rlMatrixIdentity(void);                       // Get identity matrix
@@ -1351,29 +1574,14 @@ void rlBegin(int mode)
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
     if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode != mode)
     {
-        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
-        {
-            // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
-            // that way, following QUADS drawing will keep aligned with index processing
-            // It implies adding some extra alignment vertex at the end of the draw,
-            // those vertex are not processed but they are considered as an additional offset
-            // for the next set of vertex to be drawn
-            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4);
-            else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4)));
-            else RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = 0;
-
-            if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment))
-            {
-                RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
-                RLGL.currentBatch->drawCounter++;
-            }
-        }
-
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        rlAddBatchDrawCall();
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+        rlResetBatchTextureSlots(&RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1]);
+#endif
     }
 }
 
@@ -1427,6 +1635,22 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+    // Add vertex with current texcoord and color (one contiguous write)
+    rlBatchVertex *vertex = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].data[RLGL.State.vertexCounter];
+    vertex->x = tx;
+    vertex->y = ty;
+    vertex->z = tz;
+    vertex->u = RLGL.State.texcoordx;
+    vertex->v = RLGL.State.texcoordy;
+    vertex->r = RLGL.State.colorr;
+    vertex->g = RLGL.State.colorg;
+    vertex->b = RLGL.State.colorb;
+    vertex->a = RLGL.State.colora;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    vertex->slot = (float)RLGL.State.textureSlot;
+#endif
+#else
     // Add vertices
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
@@ -1443,6 +1667,11 @@ void rlVertex3f(float x, float y, float z)
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    // Add texture slot
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texslots[RLGL.State.vertexCounter] = (float)RLGL.State.textureSlot;
+#endif
+#endif
 
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
@@ -1527,29 +1756,26 @@ void rlSetTexture(unsigned int id)
 #else
         if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
         {
-            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
-            {
-                // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
-                // that way, following QUADS drawing will keep aligned with index processing
-                // It implies adding some extra alignment vertex at the end of the draw,
-                // those vertex are not processed but they are considered as an additional offset
-                // for the next set of vertex to be drawn
-                if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4);
-                else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4)));
-                else RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = 0;
-
-                if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment))
-                {
-                    RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+            // Texture sampled from a free slot of current draw call, no new draw call required
+            int slot = rlAddBatchTextureSlot(id);
 
-                    RLGL.currentBatch->drawCounter++;
-                }
+            if (slot >= 0)
+            {
+                RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
+                RLGL.State.textureSlot = slot;
             }
+            else
+#endif
+            {
+                rlAddBatchDrawCall();
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
-
-            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
-            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+                RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
+                RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+                rlResetBatchTextureSlots(&RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1]);
+#endif
+            }
         }
 #endif
     }
@@ -1953,34 +2179,19 @@ void rlSetBlendMode(int mode)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
+        // NOTE: On batch sorting, blend mode is recorded by draw call instead of flushing the batch,
+        // custom blend modes still flush, blending factors are not recorded by draw call
+        bool customBlend = (mode == RL_BLEND_CUSTOM) || (mode == RL_BLEND_CUSTOM_SEPARATE) ||
+                           (RLGL.State.currentBlendMode == RL_BLEND_CUSTOM) || (RLGL.State.currentBlendMode == RL_BLEND_CUSTOM_SEPARATE);
 
-        switch (mode)
-        {
-            case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
-            case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_CUSTOM:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
-                glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
+        if (RLGL.State.batchSorting && !customBlend) rlAddBatchDrawCall();
+        else rlDrawRenderBatch(RLGL.currentBatch);
 
-            } break;
-            case RL_BLEND_CUSTOM_SEPARATE:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
-                glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
-                glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
-
-            } break;
-            default: break;
-        }
+        rlApplyBlendMode(mode);
 
         RLGL.State.currentBlendMode = mode;
         RLGL.State.glCustomBlendModeModified = false;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].blendMode = mode;
     }
 #endif
 }
@@ -2188,6 +2399,11 @@ void rlglClose(void)
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
+
+#if defined(GRAPHICS_API_NULL)
+    RL_FREE(RLNULL.commands);
+    RLNULL = (rlNullData){ 0 };
+#endif
 }
 
 // Load OpenGL extensions
@@ -2195,9 +2411,15 @@ void rlglClose(void)
 void rlLoadExtensions(void *loader)
 {
 #if defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
+#if defined(GRAPHICS_API_NULL)
+    // NOTE: No OpenGL context available, OpenGL functions only record commands
+    rlLoadNullFunctions();
+    TRACELOG(RL_LOG_INFO, "GL: Null backend recording functions loaded successfully");
+#else
     // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
     if (gladLoadGL((GLADloadfunc)loader) == 0) TRACELOG(RL_LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
     else TRACELOG(RL_LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
+#endif
 
     // Get number of supported extensions
     GLint numExt = 0;
@@ -2245,6 +2467,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
     #endif
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage && (glFenceSync != NULL);   // Persistent mapping (core in OpenGL 4.4), fences required
 
 #endif  // GRAPHICS_API_OPENGL_33
 
@@ -2454,6 +2677,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(RL_LOG_INFO, "GL: Persistent-mapped buffers supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2564,10 +2788,14 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
+        batch.vertexBuffer[i].mapped = false;
+        batch.vertexBuffer[i].fence = NULL;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+#if defined(RLGL_ENABLE_BATCH_STREAMING) && defined(GRAPHICS_API_OPENGL_33)
+        // NOTE: Persistent-mapped vertex arrays are directly GPU memory, mapped on VBOs creation
+        batch.vertexBuffer[i].mapped = RLGL.ExtSupported.bufferStorage;
+#endif
+        if (!batch.vertexBuffer[i].mapped) rlLoadBatchVertexArrays(&batch.vertexBuffer[i], bufferElements);
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2575,10 +2803,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2612,26 +2836,48 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         }
 
         // Quads - Vertex buffers binding and attributes enable
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+        // Interleaved vertex buffer: position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+        if (batch.vertexBuffer[i].mapped) batch.vertexBuffer[i].data = (rlBatchVertex *)rlMapBufferPersistent(bufferElements*4*sizeof(rlBatchVertex));
+        else glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(rlBatchVertex), batch.vertexBuffer[i].data, GL_DYNAMIC_DRAW);
+        rlSetBatchVertexAttributes();
+#else
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+        if (batch.vertexBuffer[i].mapped) batch.vertexBuffer[i].vertices = (float *)rlMapBufferPersistent(bufferElements*3*4*sizeof(float));
+        else glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
 
         // Vertex texcoord buffer (shader-location = 1)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+        if (batch.vertexBuffer[i].mapped) batch.vertexBuffer[i].texcoords = (float *)rlMapBufferPersistent(bufferElements*2*4*sizeof(float));
+        else glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
 
         // Vertex color buffer (shader-location = 3)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+        if (batch.vertexBuffer[i].mapped) batch.vertexBuffer[i].colors = (unsigned char *)rlMapBufferPersistent(bufferElements*4*4*sizeof(unsigned char));
+        else glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+
+        // Vertex texture slot buffer (shader-location = 8)
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
+        if (batch.vertexBuffer[i].mapped) batch.vertexBuffer[i].texslots = (float *)rlMapBufferPersistent(bufferElements*4*sizeof(float));
+        else glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(float), batch.vertexBuffer[i].texslots, GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+        glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_FLOAT, 0, 0, 0);
+#endif
+#endif
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
@@ -2642,9 +2888,36 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 #if defined(GRAPHICS_API_OPENGL_ES2)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
 #endif
+
+#if defined(RLGL_ENABLE_BATCH_STREAMING) && defined(GRAPHICS_API_OPENGL_33)
+        // Persistent mapping failed: storage is immutable, so buffers are deleted (unmapping them)
+        // and loaded again from CPU arrays, streaming this buffer through orphaning instead
+        if (batch.vertexBuffer[i].mapped && !rlIsBatchVertexBufferMapped(&batch.vertexBuffer[i]))
+        {
+            TRACELOG(RL_LOG_WARNING, "RLGL: Render batch buffer [%i] falling back to buffer orphaning", i);
+
+            glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+            glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+            glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+#endif
+            if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+
+            batch.vertexBuffer[i].mapped = false;
+            rlLoadBatchVertexArrays(&batch.vertexBuffer[i], bufferElements);
+            i--;    // Load this buffer objects again
+        }
+#endif
     }
 
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+#if defined(RLGL_ENABLE_BATCH_STREAMING)
+    if (batch.vertexBuffer[0].mapped) TRACELOG(RL_LOG_INFO, "RLGL: Render batch streaming through %i persistent-mapped buffers", numBuffers);
+    else TRACELOG(RL_LOG_INFO, "RLGL: Render batch streaming through %i orphaned buffers", numBuffers);
+    if (numBuffers < 2) TRACELOG(RL_LOG_WARNING, "RLGL: Render batch streaming with a single buffer, CPU could wait for GPU on every draw");
+#endif
 
     // Unbind the current VAO
     if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2659,9 +2932,16 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.draws[i].mode = RL_QUADS;
         batch.draws[i].vertexCount = 0;
         batch.draws[i].vertexAlignment = 0;
+        batch.draws[i].vertexOffset = 0;
         //batch.draws[i].vaoId = 0;
-        //batch.draws[i].shaderId = 0;
+        batch.draws[i].shaderId = RLGL.State.currentShaderId;
+        batch.draws[i].shaderLocs = RLGL.State.currentShaderLocs;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].blendMode = RLGL.State.currentBlendMode;
+        batch.draws[i].layer = RLGL.State.batchLayer;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+        rlResetBatchTextureSlots(&batch.draws[i]);
+#endif
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2702,14 +2982,32 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+#endif
 
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
+#if defined(RLGL_ENABLE_BATCH_STREAMING) && defined(GRAPHICS_API_OPENGL_33)
+        if (batch.vertexBuffer[i].fence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].fence);
+#endif
+
         // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].colors);
+        // NOTE: Persistent-mapped arrays are unmapped on buffers deletion
+        if (!batch.vertexBuffer[i].mapped)
+        {
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+            RL_FREE(batch.vertexBuffer[i].data);
+#else
+            RL_FREE(batch.vertexBuffer[i].vertices);
+            RL_FREE(batch.vertexBuffer[i].texcoords);
+            RL_FREE(batch.vertexBuffer[i].colors);
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+            RL_FREE(batch.vertexBuffer[i].texslots);
+#endif
+#endif
+        }
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2724,29 +3022,62 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(GRAPHICS_API_NULL)
+    if (RLGL.State.vertexCounter > 0) rlNullRecord(RL_NULL_COMMAND_FLUSH, "rlDrawRenderBatch", batch->currentBuffer, RLGL.State.vertexCounter, 0);
+#endif
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
-    if (RLGL.State.vertexCounter > 0)
+    // NOTE: Persistent-mapped buffers are coherent, vertex data is already visible to the GPU
+    if ((RLGL.State.vertexCounter > 0) && !batch->vertexBuffer[batch->currentBuffer].mapped)
     {
         // Activate elements VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+        // Interleaved vertex buffer, all attributes updated at once
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+    #if defined(RLGL_ENABLE_BATCH_STREAMING)
+        glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*sizeof(rlBatchVertex), NULL, GL_STREAM_DRAW);
+    #endif
+        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlBatchVertex), batch->vertexBuffer[batch->currentBuffer].data);
+#else
         // Vertex positions buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+#if defined(RLGL_ENABLE_BATCH_STREAMING)
+        // Orphan buffer storage: if GPU is still reading it, driver provides a new one instead of waiting
+        glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*3*4*sizeof(float), NULL, GL_STREAM_DRAW);
+#endif
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
 
         // Texture coordinates buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+#if defined(RLGL_ENABLE_BATCH_STREAMING)
+        glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*2*4*sizeof(float), NULL, GL_STREAM_DRAW);
+#endif
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
 
         // Colors buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+#if defined(RLGL_ENABLE_BATCH_STREAMING)
+        glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*4*sizeof(unsigned char), NULL, GL_STREAM_DRAW);
+#endif
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+
+        // Texture slots buffer
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
+    #if defined(RLGL_ENABLE_BATCH_STREAMING)
+        glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*sizeof(float), NULL, GL_STREAM_DRAW);
+    #endif
+        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texslots);
+#endif
+#endif
 
         // NOTE: glMapBuffer() causes sync issue.
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
@@ -2773,6 +3104,9 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     Matrix matProjection = RLGL.State.projection;
     Matrix matModelView = RLGL.State.modelview;
 
+    // Sort draw calls by state, only once for both eyes in case of stereo rendering
+    if (RLGL.State.batchSorting && (RLGL.State.vertexCounter > 0)) rlSortRenderBatchDraws(batch);
+
     int eyeCount = 1;
     if (RLGL.State.stereoRender) eyeCount = 2;
 
@@ -2808,6 +3142,11 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+                // Bind vertex attribs: position, texcoord, color (shader-location = 0, 1, 3)
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                rlSetBatchVertexAttributes();
+#else
                 // Bind vertex attrib: position (shader-location = 0)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
@@ -2822,6 +3161,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+
+                // Bind vertex attrib: texture slot (shader-location = 8)
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
+                glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_FLOAT, 0, 0, 0);
+                glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+#endif
+#endif
 
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
             }
@@ -2845,26 +3192,34 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
             glActiveTexture(GL_TEXTURE0);
 
-            for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+            if (RLGL.State.batchSorting) rlDrawRenderBatchSorted(batch, matMVPfloat);
+            else
             {
-                // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
-
-                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
-                else
+                for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
                 {
+                    // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+                    rlBindBatchTextureSlots(&batch->draws[i]);
+#else
+                    glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+#endif
+
+                    if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
+                    else
+                    {
 #if defined(GRAPHICS_API_OPENGL_33)
-                    // We need to define the number of indices to be processed: elementCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
+                        // We need to define the number of indices to be processed: elementCount*6
+                        // NOTE: The final parameter tells the GPU the offset in bytes from the
+                        // start of the index buffer to the location of the first index to process
+                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
+                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
 #endif
-                }
+                    }
 
-                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+                    vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+                }
             }
 
             if (!RLGL.ExtSupported.vao)
@@ -2885,6 +3240,15 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
     //------------------------------------------------------------------------------------------------------------
 
+#if defined(RLGL_ENABLE_BATCH_STREAMING) && defined(GRAPHICS_API_OPENGL_33)
+    // Fence the buffer just submitted, CPU must not write it again until GPU is done reading it
+    if (batch->vertexBuffer[batch->currentBuffer].mapped && (RLGL.State.vertexCounter > 0))
+    {
+        if (batch->vertexBuffer[batch->currentBuffer].fence != NULL) glDeleteSync((GLsync)batch->vertexBuffer[batch->currentBuffer].fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
+
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
     // Reset vertex counter for next frame
@@ -2902,7 +3266,15 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     {
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
+        batch->draws[i].vertexAlignment = 0;
+        batch->draws[i].shaderId = RLGL.State.currentShaderId;
+        batch->draws[i].shaderLocs = RLGL.State.currentShaderLocs;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].blendMode = RLGL.State.currentBlendMode;
+        batch->draws[i].layer = RLGL.State.batchLayer;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+        rlResetBatchTextureSlots(&batch->draws[i]);
+#endif
     }
 
     // Reset active texture units for next batch
@@ -2915,6 +3287,22 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(RLGL_ENABLE_BATCH_STREAMING) && defined(GRAPHICS_API_OPENGL_33)
+    // Wait for GPU to release next buffer in the ring before rlVertex*() writes into it
+    // NOTE: With enough buffers in the ring, fence is usually already signaled
+    if (batch->vertexBuffer[batch->currentBuffer].fence != NULL)
+    {
+        GLsync fence = (GLsync)batch->vertexBuffer[batch->currentBuffer].fence;
+        GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);     // Timeout in nanoseconds
+        while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync(fence, 0, 1000000000);
+
+        if (result == GL_WAIT_FAILED) TRACELOG(RL_LOG_WARNING, "RLGL: Render batch buffer fence wait failed");
+
+        glDeleteSync(fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = NULL;
+    }
+#endif
 #endif
 }
 
@@ -2926,6 +3314,10 @@ void rlSetRenderBatchActive(rlRenderBatch *batch)
 
     if (batch != NULL) RLGL.currentBatch = batch;
     else RLGL.currentBatch = &RLGL.defaultBatch;
+
+    // Record current state on active batch, batch could have been reset with a different state
+    // NOTE: Draw call is only updated in place if empty, pending vertex keep their own state
+    rlAddBatchDrawCall();
 #endif
 }
 
@@ -2958,12 +3350,50 @@ bool rlCheckRenderBatchLimit(int vCount)
         // Restore state of last batch so we can continue adding vertices
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+        rlResetBatchTextureSlots(&RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1]);
+#endif
     }
 #endif
 
     return overflow;
 }
 
+// Enable render batch draw calls sorting and merging by state on flush
+// NOTE: Shader uniforms are not recorded by draw call, changing uniforms of a shader
+// already used in the batch requires flushing it first with rlDrawRenderBatchActive()
+void rlEnableRenderBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.batchSorting = true;
+#endif
+}
+
+// Disable render batch draw calls sorting, draw calls are submitted in order
+void rlDisableRenderBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.batchSorting = false;
+#endif
+}
+
+// Set render batch layer for next draws
+// NOTE: On batch sorting, draws are only reordered inside a layer, lower layers are drawn first
+void rlSetRenderBatchLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchLayer != layer)
+    {
+        if (RLGL.State.batchSorting) rlAddBatchDrawCall();
+
+        RLGL.State.batchLayer = layer;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = layer;
+    }
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -3472,6 +3902,67 @@ unsigned char *rlReadScreenPixels(int width, int height)
     return imgData;     // NOTE: image data should be freed
 }
 
+// Load pixel buffer for asynchronous readback
+// NOTE: Pixel buffer objects require OpenGL 3.0 or OpenGL ES 3.0, returns 0 if not supported
+unsigned int rlLoadPixelBuffer(int size)
+{
+    unsigned int id = 0;
+
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return id;
+}
+
+// Unload pixel buffer from GPU memory
+void rlUnloadPixelBuffer(unsigned int id)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glDeleteBuffers(1, &id);
+#endif
+}
+
+// Read screen pixel data into pixel buffer
+// NOTE: Copy is queued on GPU and glReadPixels() returns immediately, data must be retrieved
+// with rlMapPixelBuffer() some frames later to avoid stalling, rows are bottom-up (not flipped)
+void rlReadScreenPixelsToBuffer(unsigned int id, int width, int height)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+// Map pixel buffer data for reading
+// NOTE: Mapping waits for pending readback to complete, returns NULL on failure
+void *rlMapPixelBuffer(unsigned int id, int size)
+{
+    void *data = NULL;
+
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return data;
+}
+
+// Unmap pixel buffer data
+void rlUnmapPixelBuffer(unsigned int id)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
 // Framebuffer management (fbo)
 //-----------------------------------------------------------------------------------------
 // Load a framebuffer to be used for rendering
@@ -3842,6 +4333,10 @@ unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
     if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
     // In case no fragment shader was provided or compilation failed, we use default fragment shader
     if (fragmentShaderId == 0) fragmentShaderId = RLGL.State.defaultFShaderId;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    // NOTE: Texture slots default fragment shader requires fragTexSlot, only written by default vertex shader
+    if ((fragmentShaderId == RLGL.State.defaultFShaderId) && (vertexShaderId != RLGL.State.defaultVShaderId)) fragmentShaderId = RLGL.State.defaultSingleFShaderId;
+#endif
 
     // In case vertex and fragment shader are the default ones, no need to recompile, we can just assign the default shader program id
     if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
@@ -3858,7 +4353,11 @@ unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
             if (id > 0) glDetachShader(id, vertexShaderId);
             glDeleteShader(vertexShaderId);
         }
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+        if ((fragmentShaderId != RLGL.State.defaultFShaderId) && (fragmentShaderId != RLGL.State.defaultSingleFShaderId))
+#else
         if (fragmentShaderId != RLGL.State.defaultFShaderId)
+#endif
         {
             // WARNING: Shader program linkage could fail and returned id is 0
             if (id > 0) glDetachShader(id, fragmentShaderId);
@@ -3976,6 +4475,11 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
     glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
     glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT);
+#endif
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
 
     // NOTE: If some attrib name is no found on the shader, it locations becomes -1
 
@@ -4103,6 +4607,34 @@ void rlSetUniformMatrix(int locIndex, Matrix mat)
 #endif
 }
 
+// Set shader value uniform matrices array
+// NOTE: Matrices are converted to column-major order, transpose is not supported on OpenGL ES 2.0
+void rlSetUniformMatrices(int locIndex, const Matrix *mats, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    float matfloat[RL_MAX_SHADER_UNIFORM_MATRICES*16];
+
+    if (count > RL_MAX_SHADER_UNIFORM_MATRICES)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Uniform matrices array limited to %i matrices (RL_MAX_SHADER_UNIFORM_MATRICES)", locIndex, RL_MAX_SHADER_UNIFORM_MATRICES);
+        count = RL_MAX_SHADER_UNIFORM_MATRICES;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        const Matrix *mat = &mats[i];
+        float *value = matfloat + i*16;
+
+        value[0] = mat->m0; value[1] = mat->m1; value[2] = mat->m2; value[3] = mat->m3;
+        value[4] = mat->m4; value[5] = mat->m5; value[6] = mat->m6; value[7] = mat->m7;
+        value[8] = mat->m8; value[9] = mat->m9; value[10] = mat->m10; value[11] = mat->m11;
+        value[12] = mat->m12; value[13] = mat->m13; value[14] = mat->m14; value[15] = mat->m15;
+    }
+
+    glUniformMatrix4fv(locIndex, count, false, matfloat);
+#endif
+}
+
 // Set shader value uniform sampler
 void rlSetUniformSampler(int locIndex, unsigned int textureId)
 {
@@ -4130,9 +4662,14 @@ void rlSetShader(unsigned int id, int *locs)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentShaderId != id)
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
+        // NOTE: On batch sorting, shader is recorded by draw call instead of flushing the batch
+        if (RLGL.State.batchSorting) rlAddBatchDrawCall();
+        else rlDrawRenderBatch(RLGL.currentBatch);
+
         RLGL.State.currentShaderId = id;
         RLGL.State.currentShaderLocs = locs;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].shaderId = id;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].shaderLocs = locs;
     }
 #endif
 }
@@ -4558,6 +5095,35 @@ const char *rlGetPixelFormatName(unsigned int format)
     }
 }
 
+#if defined(GRAPHICS_API_NULL)
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Null backend commands inspection
+//----------------------------------------------------------------------------------
+
+// Get recorded commands log
+// NOTE: Log is owned by rlgl, valid until next recorded command or reset
+const rlNullCommand *rlGetNullCommands(int *count)
+{
+    if (count != NULL) *count = RLNULL.commandCount;
+
+    return RLNULL.commands;
+}
+
+// Get recorded commands statistics
+rlNullStats rlGetNullStats(void)
+{
+    return RLNULL.stats;
+}
+
+// Reset recorded commands log and statistics
+// NOTE: Log memory is kept for next recordings
+void rlResetNullCommands(void)
+{
+    RLNULL.commandCount = 0;
+    RLNULL.stats = (rlNullStats){ 0 };
+}
+#endif  // GRAPHICS_API_NULL
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
@@ -4572,6 +5138,14 @@ static void rlLoadShaderDefault(void)
     // NOTE: All locations must be reseted to -1 (no location)
     for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.defaultShaderLocs[i] = -1;
 
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    // Texture slots sampling code generation, only slots below TEXTURE_SLOTS are compiled by GLSL preprocessor
+    #define RL_STRINGIFY(x) #x
+    #define RL_TEXTURE_SLOTS_STRING_EXPAND(x) RL_STRINGIFY(x)
+    #define RL_TEXTURE_SLOTS_STRING RL_TEXTURE_SLOTS_STRING_EXPAND(RL_DEFAULT_BATCH_TEXTURE_SLOTS)
+    #define RL_TEXTURE_SLOT_SAMPLE(i) "#if TEXTURE_SLOTS > " #i "\n    else if (fragTexSlot == " #i ") texelColor = texture(texture0[" #i "], fragTexCoord); \n#endif\n"
+#endif
+
     // Vertex shader directly defined, no external file required
     const char *defaultVShaderCode =
 #if defined(GRAPHICS_API_OPENGL_21)
@@ -4588,6 +5162,10 @@ static void rlLoadShaderDefault(void)
     "in vec4 vertexColor;               \n"
     "out vec2 fragTexCoord;             \n"
     "out vec4 fragColor;                \n"
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    "in float vertexTexSlot;            \n"
+    "flat out int fragTexSlot;          \n"
+#endif
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
     "#version 100                       \n"
@@ -4603,6 +5181,9 @@ static void rlLoadShaderDefault(void)
     "{                                  \n"
     "    fragTexCoord = vertexTexCoord; \n"
     "    fragColor = vertexColor;       \n"
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    "    fragTexSlot = int(vertexTexSlot); \n"
+#endif
     "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
     "}                                  \n";
 
@@ -4619,6 +5200,40 @@ static void rlLoadShaderDefault(void)
     "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
     "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
     "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33) && defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    // NOTE: Sampler arrays can only be indexed with constant expressions on GLSL 3.30
+    "#version 330       \n"
+    "#define TEXTURE_SLOTS " RL_TEXTURE_SLOTS_STRING "\n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "flat in int fragTexSlot;           \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0[TEXTURE_SLOTS]; \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = vec4(0.0);   \n"
+    "    if (fragTexSlot == 0) texelColor = texture(texture0[0], fragTexCoord); \n"
+    RL_TEXTURE_SLOT_SAMPLE(1) RL_TEXTURE_SLOT_SAMPLE(2) RL_TEXTURE_SLOT_SAMPLE(3)
+    RL_TEXTURE_SLOT_SAMPLE(4) RL_TEXTURE_SLOT_SAMPLE(5) RL_TEXTURE_SLOT_SAMPLE(6) RL_TEXTURE_SLOT_SAMPLE(7)
+    RL_TEXTURE_SLOT_SAMPLE(8) RL_TEXTURE_SLOT_SAMPLE(9) RL_TEXTURE_SLOT_SAMPLE(10) RL_TEXTURE_SLOT_SAMPLE(11)
+    RL_TEXTURE_SLOT_SAMPLE(12) RL_TEXTURE_SLOT_SAMPLE(13) RL_TEXTURE_SLOT_SAMPLE(14) RL_TEXTURE_SLOT_SAMPLE(15)
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+
+    // Fragment shader sampling single texture0, default fragment shader for custom vertex shaders
+    const char *defaultSingleFShaderCode =
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
 #elif defined(GRAPHICS_API_OPENGL_33)
     "#version 330       \n"
     "in vec2 fragTexCoord;              \n"
@@ -4646,10 +5261,20 @@ static void rlLoadShaderDefault(void)
     "}                                  \n";
 #endif
 
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    #undef RL_STRINGIFY
+    #undef RL_TEXTURE_SLOTS_STRING_EXPAND
+    #undef RL_TEXTURE_SLOTS_STRING
+    #undef RL_TEXTURE_SLOT_SAMPLE
+#endif
+
     // NOTE: Compiled vertex/fragment shaders are not deleted,
     // they are kept for re-use as default shaders in case some shader loading fails
     RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
     RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    RLGL.State.defaultSingleFShaderId = rlCompileShader(defaultSingleFShaderCode, GL_FRAGMENT_SHADER); // Compile default single texture fragment shader
+#endif
 
     RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
 
@@ -4666,6 +5291,24 @@ static void rlLoadShaderDefault(void)
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, "mvp");
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "colDiffuse");
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "texture0");
+
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+        // Set texture slots samplers: slot 0 on texture unit 0, next slots on units after batch active texture units
+        int maxTextureUnits = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
+
+        RLGL.State.batchTextureSlots = maxTextureUnits - RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS;
+        if (RLGL.State.batchTextureSlots > RL_DEFAULT_BATCH_TEXTURE_SLOTS) RLGL.State.batchTextureSlots = RL_DEFAULT_BATCH_TEXTURE_SLOTS;
+
+        int textureUnits[RL_DEFAULT_BATCH_TEXTURE_SLOTS] = { 0 };
+        for (int i = 1; i < RLGL.State.batchTextureSlots; i++) textureUnits[i] = RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + i;
+
+        glUseProgram(RLGL.State.defaultShaderId);
+        glUniform1iv(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], RL_DEFAULT_BATCH_TEXTURE_SLOTS, textureUnits);
+        glUseProgram(0);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader batching up to %i textures per draw call", RLGL.State.defaultShaderId, RLGL.State.batchTextureSlots);
+#endif
     }
     else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
 }
@@ -4680,6 +5323,9 @@ static void rlUnloadShaderDefault(void)
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
     glDeleteShader(RLGL.State.defaultVShaderId);
     glDeleteShader(RLGL.State.defaultFShaderId);
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    glDeleteShader(RLGL.State.defaultSingleFShaderId);
+#endif
 
     glDeleteProgram(RLGL.State.defaultShaderId);
 
@@ -4815,6 +5461,738 @@ static int rlGetPixelDataSize(int width, int height, int format)
     return dataSize;
 }
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Allocate immutable storage for currently bound GL_ARRAY_BUFFER and map it persistently for writing
+// NOTE: Coherent mapping makes CPU writes visible to next GPU draws, no flush or re-upload required
+static void *rlMapBufferPersistent(int size)
+{
+    void *buffer = NULL;
+
+#if defined(RLGL_ENABLE_BATCH_STREAMING) && defined(GRAPHICS_API_OPENGL_33)
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    glBufferStorage(GL_ARRAY_BUFFER, size, NULL, flags);
+    buffer = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+
+    if (buffer == NULL) TRACELOG(RL_LOG_ERROR, "RLGL: Failed to map persistent buffer (%i bytes)", size);
+#endif
+
+    return buffer;
+}
+
+// Load batch vertex arrays in CPU memory (RAM), uploaded to GPU on every batch draw
+static void rlLoadBatchVertexArrays(rlVertexBuffer *buffer, int bufferElements)
+{
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+    buffer->data = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));   // 4 vertex by quad
+#else
+    buffer->vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+    buffer->texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+    buffer->colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+
+    for (int j = 0; j < (3*4*bufferElements); j++) buffer->vertices[j] = 0.0f;
+    for (int j = 0; j < (2*4*bufferElements); j++) buffer->texcoords[j] = 0.0f;
+    for (int j = 0; j < (4*4*bufferElements); j++) buffer->colors[j] = 0;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    buffer->texslots = (float *)RL_CALLOC(bufferElements*4, sizeof(float));     // 1 float by vertex, 4 vertex by quad
+#endif
+#endif
+}
+
+#if defined(RLGL_ENABLE_BATCH_STREAMING) && defined(GRAPHICS_API_OPENGL_33)
+// Check all batch vertex arrays got a persistent mapping (rlMapBufferPersistent() did not fail)
+static bool rlIsBatchVertexBufferMapped(const rlVertexBuffer *buffer)
+{
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+    bool result = (buffer->data != NULL);
+#else
+    bool result = (buffer->vertices != NULL) && (buffer->texcoords != NULL) && (buffer->colors != NULL);
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    result = result && (buffer->texslots != NULL);
+#endif
+#endif
+    return result;
+}
+#endif
+
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+// Set interleaved batch vertex attributes (position, texcoord, color) for currently bound GL_ARRAY_BUFFER
+static void rlSetBatchVertexAttributes(void)
+{
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)0);
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(3*sizeof(float)));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)(5*sizeof(float)));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(6*sizeof(float)));
+    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+#endif
+}
+#endif
+
+// Apply blend mode to OpenGL state
+static void rlApplyBlendMode(int mode)
+{
+    switch (mode)
+    {
+        case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
+        case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_CUSTOM:
+        {
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
+            glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
+
+        } break;
+        case RL_BLEND_CUSTOM_SEPARATE:
+        {
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
+            glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
+            glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
+
+        } break;
+        default: break;
+    }
+}
+
+// Close current batch draw call and start a new one with current state
+// NOTE: New draw call keeps mode and texture of previous one, caller updates the state that changed
+static void rlAddBatchDrawCall(void)
+{
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (draw->vertexCount > 0)
+    {
+        // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
+        // that way, following QUADS drawing will keep aligned with index processing
+        // It implies adding some extra alignment vertex at the end of the draw,
+        // those vertex are not processed but they are considered as an additional offset
+        // for the next set of vertex to be drawn
+        if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+        else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+        else draw->vertexAlignment = 0;
+
+        if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+        {
+            RLGL.State.vertexCounter += draw->vertexAlignment;
+            RLGL.currentBatch->drawCounter++;
+        }
+    }
+
+    if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+
+    rlDrawCall *next = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (next != draw)
+    {
+        next->mode = draw->mode;
+        next->textureId = draw->textureId;
+    }
+
+    next->vertexCount = 0;
+    next->shaderId = RLGL.State.currentShaderId;
+    next->shaderLocs = RLGL.State.currentShaderLocs;
+    next->blendMode = RLGL.State.currentBlendMode;
+    next->layer = RLGL.State.batchLayer;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    rlResetBatchTextureSlots(next);
+#endif
+}
+
+// Compare draw calls by state: layer, shader, blend mode, texture and mode
+static int rlCompareDrawCalls(const rlDrawCall *a, const rlDrawCall *b)
+{
+    if (a->layer != b->layer) return (a->layer < b->layer)? -1 : 1;
+    if (a->shaderId != b->shaderId) return (a->shaderId < b->shaderId)? -1 : 1;
+    if (a->blendMode != b->blendMode) return (a->blendMode < b->blendMode)? -1 : 1;
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+    if (a->textureSlotCount != b->textureSlotCount) return (a->textureSlotCount < b->textureSlotCount)? -1 : 1;
+    for (int i = 0; i < a->textureSlotCount; i++)
+    {
+        if (a->textureSlots[i] != b->textureSlots[i]) return (a->textureSlots[i] < b->textureSlots[i])? -1 : 1;
+    }
+#else
+    if (a->textureId != b->textureId) return (a->textureId < b->textureId)? -1 : 1;
+#endif
+    if (a->mode != b->mode) return (a->mode < b->mode)? -1 : 1;
+
+    return 0;
+}
+
+// Sort render batch draw calls by state, keeping submission order of draws with same state
+// NOTE: Vertex offsets are computed before sorting, vertex data is not moved
+static void rlSortRenderBatchDraws(rlRenderBatch *batch)
+{
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        batch->draws[i].vertexOffset = vertexOffset;
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+    }
+
+    // Insertion sort: stable and fast for the usual few, mostly sorted, draw calls
+    for (int i = 1; i < batch->drawCounter; i++)
+    {
+        rlDrawCall draw = batch->draws[i];
+        int j = i - 1;
+
+        while ((j >= 0) && (rlCompareDrawCalls(&batch->draws[j], &draw) > 0))
+        {
+            batch->draws[j + 1] = batch->draws[j];
+            j--;
+        }
+
+        batch->draws[j + 1] = draw;
+    }
+}
+
+// Draw sorted render batch draw calls, merging draws with same state in a single submission
+// NOTE: Expects batch vertex buffers and default shader bound, as done by rlDrawRenderBatch()
+static void rlDrawRenderBatchSorted(rlRenderBatch *batch, const float *matMVP)
+{
+    GLint firsts[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    GLsizei counts[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33)
+    const void *indices[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+#endif
+
+    unsigned int shaderId = RLGL.State.currentShaderId;     // Already bound by rlDrawRenderBatch()
+    int blendMode = -1;                                     // Force blend mode setup on first draw
+
+    for (int i = 0, next = 0; i < batch->drawCounter; i = next)
+    {
+        // Gather vertex ranges of all draws sharing state, contiguous ranges are joined
+        int rangeCount = 0;
+
+        for (next = i; (next < batch->drawCounter) && (rlCompareDrawCalls(&batch->draws[i], &batch->draws[next]) == 0); next++)
+        {
+            if (batch->draws[next].vertexCount == 0) continue;
+
+            if ((rangeCount > 0) && ((firsts[rangeCount - 1] + counts[rangeCount - 1]) == batch->draws[next].vertexOffset)) counts[rangeCount - 1] += batch->draws[next].vertexCount;
+            else
+            {
+                firsts[rangeCount] = batch->draws[next].vertexOffset;
+                counts[rangeCount] = batch->draws[next].vertexCount;
+                rangeCount++;
+            }
+        }
+
+        if (rangeCount == 0) continue;
+
+        rlDrawCall *draw = &batch->draws[i];
+
+        if (draw->shaderId != shaderId)
+        {
+            shaderId = draw->shaderId;
+            glUseProgram(shaderId);
+            glUniformMatrix4fv(draw->shaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVP);
+            glUniform4f(draw->shaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+            glUniform1i(draw->shaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);
+        }
+
+        if (draw->blendMode != blendMode)
+        {
+            blendMode = draw->blendMode;
+            rlApplyBlendMode(blendMode);
+        }
+
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+        rlBindBatchTextureSlots(draw);
+#else
+        glBindTexture(GL_TEXTURE_2D, draw->textureId);
+#endif
+
+        if ((draw->mode == RL_LINES) || (draw->mode == RL_TRIANGLES))
+        {
+#if defined(GRAPHICS_API_OPENGL_33)
+            glMultiDrawArrays(draw->mode, firsts, counts, rangeCount);
+#else
+            for (int r = 0; r < rangeCount; r++) glDrawArrays(draw->mode, firsts[r], counts[r]);
+#endif
+        }
+        else
+        {
+#if defined(GRAPHICS_API_OPENGL_33)
+            for (int r = 0; r < rangeCount; r++)
+            {
+                indices[r] = (const void *)(firsts[r]/4*6*sizeof(GLuint));
+                counts[r] = counts[r]/4*6;
+            }
+
+            glMultiDrawElements(GL_TRIANGLES, counts, GL_UNSIGNED_INT, indices, rangeCount);
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            for (int r = 0; r < rangeCount; r++) glDrawElements(GL_TRIANGLES, counts[r]/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(firsts[r]/4*6*sizeof(GLushort)));
+#endif
+        }
+    }
+
+    // Restore current blend mode, it could be required by draws out of the batch
+    if (blendMode != RLGL.State.currentBlendMode) rlApplyBlendMode(RLGL.State.currentBlendMode);
+}
+
+#if defined(RLGL_ENABLE_BATCH_TEXTURE_SLOTS)
+// Reset draw call texture slots to draw call texture only (slot 0)
+static void rlResetBatchTextureSlots(rlDrawCall *draw)
+{
+    draw->textureSlots[0] = draw->textureId;
+    draw->textureSlotCount = 1;
+
+    // Following vertex of the active draw call sample its texture
+    if ((RLGL.currentBatch != NULL) && (draw == &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1])) RLGL.State.textureSlot = 0;
+}
+
+// Get texture slot for texture on current draw call, adding it to a free slot if required
+// NOTE: Returns -1 if texture can not be sampled by current draw call (no free slots or not using default shader)
+static int rlAddBatchTextureSlot(unsigned int id)
+{
+    int slot = -1;
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if ((RLGL.State.currentShaderId == RLGL.State.defaultShaderId) && (RLGL.State.batchTextureSlots > 1))
+    {
+        for (int i = 0; i < draw->textureSlotCount; i++)
+        {
+            if (draw->textureSlots[i] == id)
+            {
+                slot = i;
+                break;
+            }
+        }
+
+        if ((slot == -1) && (draw->textureSlotCount < RLGL.State.batchTextureSlots))
+        {
+            slot = draw->textureSlotCount;
+            draw->textureSlots[slot] = id;
+            draw->textureSlotCount++;
+        }
+    }
+
+    return slot;
+}
+
+// Bind draw call texture slots: slot 0 to GL_TEXTURE0, next slots to units after batch active texture units
+static void rlBindBatchTextureSlots(const rlDrawCall *draw)
+{
+    if (draw->textureSlotCount > 1)
+    {
+        for (int i = 1; i < draw->textureSlotCount; i++)
+        {
+            glActiveTexture(GL_TEXTURE0 + RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + i);
+            glBindTexture(GL_TEXTURE_2D, draw->textureSlots[i]);
+        }
+
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, draw->textureSlots[0]);
+}
+#endif
+#endif
+
+#if defined(GRAPHICS_API_NULL)
+// Null backend: OpenGL functions replaced by commands recording stubs
+//----------------------------------------------------------------------------------
+// Record command into null backend log and statistics
+static void rlNullRecord(int type, const char *name, unsigned int param, int count, int bytes)
+{
+    RLNULL.stats.commands++;
+
+    switch (type)
+    {
+        case RL_NULL_COMMAND_STATE: RLNULL.stats.stateChanges++; break;
+        case RL_NULL_COMMAND_RESOURCE: RLNULL.stats.resources++; break;
+        case RL_NULL_COMMAND_UPLOAD: RLNULL.stats.uploads++; RLNULL.stats.uploadBytes += bytes; break;
+        case RL_NULL_COMMAND_DRAW: RLNULL.stats.drawCalls++; RLNULL.stats.drawElements += count; break;
+        case RL_NULL_COMMAND_READBACK: RLNULL.stats.readbacks++; RLNULL.stats.readbackBytes += bytes; break;
+        case RL_NULL_COMMAND_QUERY: RLNULL.stats.queries++; break;
+        case RL_NULL_COMMAND_FLUSH: RLNULL.stats.flushes++; RLNULL.stats.batchVertices += count; break;
+        default: break;
+    }
+
+    // NOTE: Log keeps growing up to RL_NULL_MAX_COMMANDS, statistics keep counting after that
+    if (RLNULL.commandCount >= RL_NULL_MAX_COMMANDS) return;
+
+    if (RLNULL.commandCount >= RLNULL.capacity)
+    {
+        int capacity = (RLNULL.capacity == 0)? 1024 : RLNULL.capacity*2;
+        if (capacity > RL_NULL_MAX_COMMANDS) capacity = RL_NULL_MAX_COMMANDS;
+
+        rlNullCommand *commands = (rlNullCommand *)RL_REALLOC(RLNULL.commands, capacity*sizeof(rlNullCommand));
+        if (commands == NULL) return;
+
+        RLNULL.commands = commands;
+        RLNULL.capacity = capacity;
+    }
+
+    rlNullCommand *command = &RLNULL.commands[RLNULL.commandCount];
+    command->type = type;
+    command->name = name;
+    command->param = param;
+    command->count = count;
+    command->bytes = bytes;
+
+    RLNULL.commandCount++;
+}
+
+// Get size in bytes of pixels data for provided OpenGL format and type
+static int rlNullPixelDataSize(int width, int height, GLenum format, GLenum type)
+{
+    int components = 4;
+    int typeSize = 1;
+
+    switch (format)
+    {
+        case GL_RED:
+        case GL_DEPTH_COMPONENT: components = 1; break;
+        case GL_RG: components = 2; break;
+        case GL_RGB: components = 3; break;
+        default: break;
+    }
+
+    switch (type)
+    {
+        case GL_UNSIGNED_SHORT:
+        case GL_HALF_FLOAT: typeSize = 2; break;
+        case GL_UNSIGNED_INT:
+        case GL_FLOAT: typeSize = 4; break;
+        case GL_UNSIGNED_SHORT_5_6_5:
+        case GL_UNSIGNED_SHORT_5_5_5_1:
+        case GL_UNSIGNED_SHORT_4_4_4_4: components = 1; typeSize = 2; break;    // Packed pixel formats
+        default: break;
+    }
+
+    return width*height*components*typeSize;
+}
+
+// Generate sequential object ids, deterministic between runs
+static void rlNullGenObjects(const char *name, GLsizei n, GLuint *ids)
+{
+    for (int i = 0; i < n; i++) ids[i] = ++RLNULL.objectCounter;
+    rlNullRecord(RL_NULL_COMMAND_RESOURCE, name, (n > 0)? ids[0] : 0, n, 0);
+}
+
+// State changes
+static void GLAD_API_PTR rlNullActiveTexture(GLenum texture) { rlNullRecord(RL_NULL_COMMAND_STATE, "glActiveTexture", texture, 0, 0); }
+static void GLAD_API_PTR rlNullAttachShader(GLuint program, GLuint shader) { rlNullRecord(RL_NULL_COMMAND_STATE, "glAttachShader", shader, 0, 0); }
+static void GLAD_API_PTR rlNullBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { rlNullRecord(RL_NULL_COMMAND_STATE, "glBindAttribLocation", index, 0, 0); }
+static void GLAD_API_PTR rlNullBindBuffer(GLenum target, GLuint buffer) { rlNullRecord(RL_NULL_COMMAND_STATE, "glBindBuffer", buffer, 0, 0); }
+static void GLAD_API_PTR rlNullBindFramebuffer(GLenum target, GLuint framebuffer) { rlNullRecord(RL_NULL_COMMAND_STATE, "glBindFramebuffer", framebuffer, 0, 0); }
+static void GLAD_API_PTR rlNullBindRenderbuffer(GLenum target, GLuint renderbuffer) { rlNullRecord(RL_NULL_COMMAND_STATE, "glBindRenderbuffer", renderbuffer, 0, 0); }
+static void GLAD_API_PTR rlNullBindTexture(GLenum target, GLuint texture) { rlNullRecord(RL_NULL_COMMAND_STATE, "glBindTexture", texture, 0, 0); }
+static void GLAD_API_PTR rlNullBindVertexArray(GLuint array) { rlNullRecord(RL_NULL_COMMAND_STATE, "glBindVertexArray", array, 0, 0); }
+static void GLAD_API_PTR rlNullBlendEquation(GLenum mode) { rlNullRecord(RL_NULL_COMMAND_STATE, "glBlendEquation", mode, 0, 0); }
+static void GLAD_API_PTR rlNullBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { rlNullRecord(RL_NULL_COMMAND_STATE, "glBlendEquationSeparate", modeRGB, 0, 0); }
+static void GLAD_API_PTR rlNullBlendFunc(GLenum sfactor, GLenum dfactor) { rlNullRecord(RL_NULL_COMMAND_STATE, "glBlendFunc", sfactor, 0, 0); }
+static void GLAD_API_PTR rlNullBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { rlNullRecord(RL_NULL_COMMAND_STATE, "glBlendFuncSeparate", sfactorRGB, 0, 0); }
+static void GLAD_API_PTR rlNullClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { rlNullRecord(RL_NULL_COMMAND_STATE, "glClearColor", 0, 0, 0); }
+static void GLAD_API_PTR rlNullClearDepth(GLdouble depth) { rlNullRecord(RL_NULL_COMMAND_STATE, "glClearDepth", 0, 0, 0); }
+static void GLAD_API_PTR rlNullCullFace(GLenum mode) { rlNullRecord(RL_NULL_COMMAND_STATE, "glCullFace", mode, 0, 0); }
+static void GLAD_API_PTR rlNullDepthFunc(GLenum func) { rlNullRecord(RL_NULL_COMMAND_STATE, "glDepthFunc", func, 0, 0); }
+static void GLAD_API_PTR rlNullDepthMask(GLboolean flag) { rlNullRecord(RL_NULL_COMMAND_STATE, "glDepthMask", flag, 0, 0); }
+static void GLAD_API_PTR rlNullDetachShader(GLuint program, GLuint shader) { rlNullRecord(RL_NULL_COMMAND_STATE, "glDetachShader", shader, 0, 0); }
+static void GLAD_API_PTR rlNullDisable(GLenum cap) { rlNullRecord(RL_NULL_COMMAND_STATE, "glDisable", cap, 0, 0); }
+static void GLAD_API_PTR rlNullDisableVertexAttribArray(GLuint index) { rlNullRecord(RL_NULL_COMMAND_STATE, "glDisableVertexAttribArray", index, 0, 0); }
+static void GLAD_API_PTR rlNullDrawBuffers(GLsizei n, const GLenum *bufs) { rlNullRecord(RL_NULL_COMMAND_STATE, "glDrawBuffers", 0, n, 0); }
+static void GLAD_API_PTR rlNullEnable(GLenum cap) { rlNullRecord(RL_NULL_COMMAND_STATE, "glEnable", cap, 0, 0); }
+static void GLAD_API_PTR rlNullEnableVertexAttribArray(GLuint index) { rlNullRecord(RL_NULL_COMMAND_STATE, "glEnableVertexAttribArray", index, 0, 0); }
+static void GLAD_API_PTR rlNullFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { rlNullRecord(RL_NULL_COMMAND_STATE, "glFramebufferRenderbuffer", renderbuffer, 0, 0); }
+static void GLAD_API_PTR rlNullFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { rlNullRecord(RL_NULL_COMMAND_STATE, "glFramebufferTexture2D", texture, 0, 0); }
+static void GLAD_API_PTR rlNullFrontFace(GLenum mode) { rlNullRecord(RL_NULL_COMMAND_STATE, "glFrontFace", mode, 0, 0); }
+static void GLAD_API_PTR rlNullLineWidth(GLfloat width) { rlNullRecord(RL_NULL_COMMAND_STATE, "glLineWidth", 0, 0, 0); }
+static void GLAD_API_PTR rlNullPixelStorei(GLenum pname, GLint param) { rlNullRecord(RL_NULL_COMMAND_STATE, "glPixelStorei", pname, 0, 0); }
+static void GLAD_API_PTR rlNullPolygonMode(GLenum face, GLenum mode) { rlNullRecord(RL_NULL_COMMAND_STATE, "glPolygonMode", mode, 0, 0); }
+static void GLAD_API_PTR rlNullScissor(GLint x, GLint y, GLsizei width, GLsizei height) { rlNullRecord(RL_NULL_COMMAND_STATE, "glScissor", 0, 0, 0); }
+static void GLAD_API_PTR rlNullTexParameterf(GLenum target, GLenum pname, GLfloat param) { rlNullRecord(RL_NULL_COMMAND_STATE, "glTexParameterf", pname, 0, 0); }
+static void GLAD_API_PTR rlNullTexParameteri(GLenum target, GLenum pname, GLint param) { rlNullRecord(RL_NULL_COMMAND_STATE, "glTexParameteri", pname, 0, 0); }
+static void GLAD_API_PTR rlNullTexParameteriv(GLenum target, GLenum pname, const GLint *params) { rlNullRecord(RL_NULL_COMMAND_STATE, "glTexParameteriv", pname, 0, 0); }
+static void GLAD_API_PTR rlNullUseProgram(GLuint program) { rlNullRecord(RL_NULL_COMMAND_STATE, "glUseProgram", program, 0, 0); }
+static void GLAD_API_PTR rlNullVertexAttribDivisor(GLuint index, GLuint divisor) { rlNullRecord(RL_NULL_COMMAND_STATE, "glVertexAttribDivisor", index, 0, 0); }
+static void GLAD_API_PTR rlNullVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { rlNullRecord(RL_NULL_COMMAND_STATE, "glVertexAttribPointer", index, 0, 0); }
+static void GLAD_API_PTR rlNullViewport(GLint x, GLint y, GLsizei width, GLsizei height) { rlNullRecord(RL_NULL_COMMAND_STATE, "glViewport", 0, 0, 0); }
+
+// Resources creation/destruction
+static void GLAD_API_PTR rlNullGenBuffers(GLsizei n, GLuint *buffers) { rlNullGenObjects("glGenBuffers", n, buffers); }
+static void GLAD_API_PTR rlNullGenFramebuffers(GLsizei n, GLuint *framebuffers) { rlNullGenObjects("glGenFramebuffers", n, framebuffers); }
+static void GLAD_API_PTR rlNullGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { rlNullGenObjects("glGenRenderbuffers", n, renderbuffers); }
+static void GLAD_API_PTR rlNullGenTextures(GLsizei n, GLuint *textures) { rlNullGenObjects("glGenTextures", n, textures); }
+static void GLAD_API_PTR rlNullGenVertexArrays(GLsizei n, GLuint *arrays) { rlNullGenObjects("glGenVertexArrays", n, arrays); }
+static void GLAD_API_PTR rlNullDeleteBuffers(GLsizei n, const GLuint *buffers) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glDeleteBuffers", (n > 0)? buffers[0] : 0, n, 0); }
+static void GLAD_API_PTR rlNullDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glDeleteFramebuffers", (n > 0)? framebuffers[0] : 0, n, 0); }
+static void GLAD_API_PTR rlNullDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glDeleteRenderbuffers", (n > 0)? renderbuffers[0] : 0, n, 0); }
+static void GLAD_API_PTR rlNullDeleteTextures(GLsizei n, const GLuint *textures) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glDeleteTextures", (n > 0)? textures[0] : 0, n, 0); }
+static void GLAD_API_PTR rlNullDeleteVertexArrays(GLsizei n, const GLuint *arrays) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glDeleteVertexArrays", (n > 0)? arrays[0] : 0, n, 0); }
+static GLuint GLAD_API_PTR rlNullCreateProgram(void) { GLuint id = ++RLNULL.objectCounter; rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glCreateProgram", id, 1, 0); return id; }
+static GLuint GLAD_API_PTR rlNullCreateShader(GLenum type) { GLuint id = ++RLNULL.objectCounter; rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glCreateShader", id, 1, 0); return id; }
+static void GLAD_API_PTR rlNullDeleteProgram(GLuint program) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glDeleteProgram", program, 1, 0); }
+static void GLAD_API_PTR rlNullDeleteShader(GLuint shader) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glDeleteShader", shader, 1, 0); }
+static void GLAD_API_PTR rlNullCompileShader(GLuint shader) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glCompileShader", shader, 0, 0); }
+static void GLAD_API_PTR rlNullLinkProgram(GLuint program) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glLinkProgram", program, 0, 0); }
+static void GLAD_API_PTR rlNullGenerateMipmap(GLenum target) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glGenerateMipmap", target, 0, 0); }
+static void GLAD_API_PTR rlNullRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glRenderbufferStorage", internalformat, 0, 0); }
+static GLsync GLAD_API_PTR rlNullFenceSync(GLenum condition, GLbitfield flags) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glFenceSync", 0, 1, 0); return (GLsync)&RLNULL; }
+static void GLAD_API_PTR rlNullDeleteSync(GLsync sync) { rlNullRecord(RL_NULL_COMMAND_RESOURCE, "glDeleteSync", 0, 1, 0); }
+
+// Data uploads
+static void GLAD_API_PTR rlNullShaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length)
+{
+    int bytes = 0;
+    for (int i = 0; i < count; i++) bytes += ((length != NULL) && (length[i] >= 0))? length[i] : (int)strlen(string[i]);
+    rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glShaderSource", shader, count, bytes);
+}
+static void GLAD_API_PTR rlNullBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glBufferData", target, 0, (data != NULL)? (int)size : 0); }
+static void GLAD_API_PTR rlNullBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glBufferStorage", target, 0, (data != NULL)? (int)size : 0); }
+static void GLAD_API_PTR rlNullBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glBufferSubData", target, 0, (int)size); }
+static void GLAD_API_PTR rlNullTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glTexImage2D", target, level, (pixels != NULL)? rlNullPixelDataSize(width, height, format, type) : 0); }
+static void GLAD_API_PTR rlNullTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glTexSubImage2D", target, level, rlNullPixelDataSize(width, height, format, type)); }
+static void GLAD_API_PTR rlNullCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glCompressedTexImage2D", target, level, imageSize); }
+static void GLAD_API_PTR rlNullUniform1i(GLint location, GLint v0) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUniform1i", location, 1, sizeof(GLint)); }
+static void GLAD_API_PTR rlNullUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUniform4f", location, 1, 4*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullUniform1fv(GLint location, GLsizei count, const GLfloat *value) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUniform1fv", location, count, count*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullUniform2fv(GLint location, GLsizei count, const GLfloat *value) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUniform2fv", location, count, count*2*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullUniform3fv(GLint location, GLsizei count, const GLfloat *value) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUniform3fv", location, count, count*3*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullUniform4fv(GLint location, GLsizei count, const GLfloat *value) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUniform4fv", location, count, count*4*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullUniform1iv(GLint location, GLsizei count, const GLint *value) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUniform1iv", location, count, count*sizeof(GLint)); }
+static void GLAD_API_PTR rlNullUniform2iv(GLint location, GLsizei count, const GLint *value) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUniform2iv", location, count, count*2*sizeof(GLint)); }
+static void GLAD_API_PTR rlNullUniform3iv(GLint location, GLsizei count, const GLint *value) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUniform3iv", location, count, count*3*sizeof(GLint)); }
+static void GLAD_API_PTR rlNullUniform4iv(GLint location, GLsizei count, const GLint *value) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUniform4iv", location, count, count*4*sizeof(GLint)); }
+static void GLAD_API_PTR rlNullUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUniformMatrix4fv", location, count, count*16*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullVertexAttrib1fv(GLuint index, const GLfloat *v) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glVertexAttrib1fv", index, 1, sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullVertexAttrib2fv(GLuint index, const GLfloat *v) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glVertexAttrib2fv", index, 1, 2*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullVertexAttrib3fv(GLuint index, const GLfloat *v) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glVertexAttrib3fv", index, 1, 3*sizeof(GLfloat)); }
+static void GLAD_API_PTR rlNullVertexAttrib4fv(GLuint index, const GLfloat *v) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glVertexAttrib4fv", index, 1, 4*sizeof(GLfloat)); }
+static void *GLAD_API_PTR rlNullMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glMapBufferRange", target, 0, 0); return NULL; }
+static GLboolean GLAD_API_PTR rlNullUnmapBuffer(GLenum target) { rlNullRecord(RL_NULL_COMMAND_UPLOAD, "glUnmapBuffer", target, 0, 0); return GL_TRUE; }
+
+// Draw calls
+static void GLAD_API_PTR rlNullClear(GLbitfield mask) { rlNullRecord(RL_NULL_COMMAND_DRAW, "glClear", mask, 0, 0); }
+static void GLAD_API_PTR rlNullBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { rlNullRecord(RL_NULL_COMMAND_DRAW, "glBlitFramebuffer", mask, 0, 0); }
+static void GLAD_API_PTR rlNullDrawArrays(GLenum mode, GLint first, GLsizei count) { rlNullRecord(RL_NULL_COMMAND_DRAW, "glDrawArrays", mode, count, 0); }
+static void GLAD_API_PTR rlNullDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { rlNullRecord(RL_NULL_COMMAND_DRAW, "glDrawArraysInstanced", mode, count*instancecount, 0); }
+static void GLAD_API_PTR rlNullDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { rlNullRecord(RL_NULL_COMMAND_DRAW, "glDrawElements", mode, count, 0); }
+static void GLAD_API_PTR rlNullDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { rlNullRecord(RL_NULL_COMMAND_DRAW, "glDrawElementsInstanced", mode, count*instancecount, 0); }
+static void GLAD_API_PTR rlNullMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+    int total = 0;
+    for (int i = 0; i < drawcount; i++) total += count[i];
+    rlNullRecord(RL_NULL_COMMAND_DRAW, "glMultiDrawArrays", mode, total, 0);
+}
+static void GLAD_API_PTR rlNullMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const *indices, GLsizei drawcount)
+{
+    int total = 0;
+    for (int i = 0; i < drawcount; i++) total += count[i];
+    rlNullRecord(RL_NULL_COMMAND_DRAW, "glMultiDrawElements", mode, total, 0);
+}
+
+// Data readbacks
+// NOTE: Texture size is not tracked, glGetTexImage() does not write pixels data
+static void GLAD_API_PTR rlNullGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { rlNullRecord(RL_NULL_COMMAND_READBACK, "glGetTexImage", target, level, 0); }
+static void GLAD_API_PTR rlNullReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    int size = rlNullPixelDataSize(width, height, format, type);
+    if (pixels != NULL) memset(pixels, 0, size);
+    rlNullRecord(RL_NULL_COMMAND_READBACK, "glReadPixels", format, 0, size);
+}
+
+// State queries, returning capabilities of a generic OpenGL 3.3 device
+static GLenum GLAD_API_PTR rlNullGetError(void) { return GL_NO_ERROR; }
+static GLenum GLAD_API_PTR rlNullCheckFramebufferStatus(GLenum target) { rlNullRecord(RL_NULL_COMMAND_QUERY, "glCheckFramebufferStatus", target, 0, 0); return GL_FRAMEBUFFER_COMPLETE; }
+static GLenum GLAD_API_PTR rlNullClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { rlNullRecord(RL_NULL_COMMAND_QUERY, "glClientWaitSync", 0, 0, 0); return GL_ALREADY_SIGNALED; }
+static GLint GLAD_API_PTR rlNullGetAttribLocation(GLuint program, const GLchar *name)
+{
+    GLint location = -1;
+
+    // NOTE: Default attributes locations are bound by rlLoadShaderProgram()
+    if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION) == 0) location = 0;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD) == 0) location = 1;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL) == 0) location = 2;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR) == 0) location = 3;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT) == 0) location = 4;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2) == 0) location = 5;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS;
+    else if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS) == 0) location = RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS;
+
+    rlNullRecord(RL_NULL_COMMAND_QUERY, "glGetAttribLocation", program, 0, 0);
+
+    return location;
+}
+static GLint GLAD_API_PTR rlNullGetUniformLocation(GLuint program, const GLchar *name) { rlNullRecord(RL_NULL_COMMAND_QUERY, "glGetUniformLocation", program, 0, 0); return RLNULL.locationCounter++; }
+static void GLAD_API_PTR rlNullGetFloatv(GLenum pname, GLfloat *data)
+{
+    if (pname == GL_LINE_WIDTH) data[0] = 1.0f;
+    else data[0] = 0.0f;
+
+    rlNullRecord(RL_NULL_COMMAND_QUERY, "glGetFloatv", pname, 0, 0);
+}
+static void GLAD_API_PTR rlNullGetIntegerv(GLenum pname, GLint *data)
+{
+    switch (pname)
+    {
+        case GL_MAX_TEXTURE_SIZE: data[0] = 16384; break;
+        case GL_MAX_CUBE_MAP_TEXTURE_SIZE: data[0] = 16384; break;
+        case GL_MAX_TEXTURE_IMAGE_UNITS: data[0] = 32; break;
+        case GL_MAX_VERTEX_ATTRIBS: data[0] = 16; break;
+        case GL_MAX_UNIFORM_BLOCK_SIZE: data[0] = 65536; break;
+        case GL_MAX_DRAW_BUFFERS: data[0] = 8; break;
+        default: data[0] = 0; break;     // GL_NUM_EXTENSIONS, GL_NUM_COMPRESSED_TEXTURE_FORMATS...
+    }
+
+    rlNullRecord(RL_NULL_COMMAND_QUERY, "glGetIntegerv", pname, 0, 0);
+}
+static void GLAD_API_PTR rlNullGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { params[0] = 0; rlNullRecord(RL_NULL_COMMAND_QUERY, "glGetFramebufferAttachmentParameteriv", pname, 0, 0); }
+static void GLAD_API_PTR rlNullGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    params[0] = (pname == GL_LINK_STATUS)? GL_TRUE : 0;     // Link always succeeds, no active uniforms or info log
+    rlNullRecord(RL_NULL_COMMAND_QUERY, "glGetProgramiv", pname, 0, 0);
+}
+static void GLAD_API_PTR rlNullGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    params[0] = (pname == GL_COMPILE_STATUS)? GL_TRUE : 0;  // Compilation always succeeds, no info log
+    rlNullRecord(RL_NULL_COMMAND_QUERY, "glGetShaderiv", pname, 0, 0);
+}
+static void GLAD_API_PTR rlNullGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { if (length != NULL) length[0] = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+static void GLAD_API_PTR rlNullGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { if (length != NULL) length[0] = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+static const GLubyte *GLAD_API_PTR rlNullGetString(GLenum name)
+{
+    const char *string = "";
+
+    switch (name)
+    {
+        case GL_VENDOR: string = "raylib"; break;
+        case GL_RENDERER: string = "rlgl null backend"; break;
+        case GL_VERSION: string = "3.3 (null)"; break;
+        case GL_SHADING_LANGUAGE_VERSION: string = "3.30"; break;
+        default: break;
+    }
+
+    return (const GLubyte *)string;
+}
+static const GLubyte *GLAD_API_PTR rlNullGetStringi(GLenum name, GLuint index) { return (const GLubyte *)""; }
+
+// Load null backend OpenGL functions (replacing glad loaded functions)
+static void rlLoadNullFunctions(void)
+{
+    glad_glActiveTexture = rlNullActiveTexture;
+    glad_glAttachShader = rlNullAttachShader;
+    glad_glBindAttribLocation = rlNullBindAttribLocation;
+    glad_glBindBuffer = rlNullBindBuffer;
+    glad_glBindFramebuffer = rlNullBindFramebuffer;
+    glad_glBindRenderbuffer = rlNullBindRenderbuffer;
+    glad_glBindTexture = rlNullBindTexture;
+    glad_glBindVertexArray = rlNullBindVertexArray;
+    glad_glBlendEquation = rlNullBlendEquation;
+    glad_glBlendEquationSeparate = rlNullBlendEquationSeparate;
+    glad_glBlendFunc = rlNullBlendFunc;
+    glad_glBlendFuncSeparate = rlNullBlendFuncSeparate;
+    glad_glClearColor = rlNullClearColor;
+    glad_glClearDepth = rlNullClearDepth;
+    glad_glCullFace = rlNullCullFace;
+    glad_glDepthFunc = rlNullDepthFunc;
+    glad_glDepthMask = rlNullDepthMask;
+    glad_glDetachShader = rlNullDetachShader;
+    glad_glDisable = rlNullDisable;
+    glad_glDisableVertexAttribArray = rlNullDisableVertexAttribArray;
+    glad_glDrawBuffers = rlNullDrawBuffers;
+    glad_glEnable = rlNullEnable;
+    glad_glEnableVertexAttribArray = rlNullEnableVertexAttribArray;
+    glad_glFramebufferRenderbuffer = rlNullFramebufferRenderbuffer;
+    glad_glFramebufferTexture2D = rlNullFramebufferTexture2D;
+    glad_glFrontFace = rlNullFrontFace;
+    glad_glLineWidth = rlNullLineWidth;
+    glad_glPixelStorei = rlNullPixelStorei;
+    glad_glPolygonMode = rlNullPolygonMode;
+    glad_glScissor = rlNullScissor;
+    glad_glTexParameterf = rlNullTexParameterf;
+    glad_glTexParameteri = rlNullTexParameteri;
+    glad_glTexParameteriv = rlNullTexParameteriv;
+    glad_glUseProgram = rlNullUseProgram;
+    glad_glVertexAttribDivisor = rlNullVertexAttribDivisor;
+    glad_glVertexAttribPointer = rlNullVertexAttribPointer;
+    glad_glViewport = rlNullViewport;
+
+    glad_glGenBuffers = rlNullGenBuffers;
+    glad_glGenFramebuffers = rlNullGenFramebuffers;
+    glad_glGenRenderbuffers = rlNullGenRenderbuffers;
+    glad_glGenTextures = rlNullGenTextures;
+    glad_glGenVertexArrays = rlNullGenVertexArrays;
+    glad_glDeleteBuffers = rlNullDeleteBuffers;
+    glad_glDeleteFramebuffers = rlNullDeleteFramebuffers;
+    glad_glDeleteRenderbuffers = rlNullDeleteRenderbuffers;
+    glad_glDeleteTextures = rlNullDeleteTextures;
+    glad_glDeleteVertexArrays = rlNullDeleteVertexArrays;
+    glad_glCreateProgram = rlNullCreateProgram;
+    glad_glCreateShader = rlNullCreateShader;
+    glad_glDeleteProgram = rlNullDeleteProgram;
+    glad_glDeleteShader = rlNullDeleteShader;
+    glad_glCompileShader = rlNullCompileShader;
+    glad_glLinkProgram = rlNullLinkProgram;
+    glad_glGenerateMipmap = rlNullGenerateMipmap;
+    glad_glRenderbufferStorage = rlNullRenderbufferStorage;
+    glad_glFenceSync = rlNullFenceSync;
+    glad_glDeleteSync = rlNullDeleteSync;
+
+    glad_glShaderSource = rlNullShaderSource;
+    glad_glBufferData = rlNullBufferData;
+    glad_glBufferStorage = rlNullBufferStorage;
+    glad_glBufferSubData = rlNullBufferSubData;
+    glad_glTexImage2D = rlNullTexImage2D;
+    glad_glTexSubImage2D = rlNullTexSubImage2D;
+    glad_glCompressedTexImage2D = rlNullCompressedTexImage2D;
+    glad_glUniform1i = rlNullUniform1i;
+    glad_glUniform4f = rlNullUniform4f;
+    glad_glUniform1fv = rlNullUniform1fv;
+    glad_glUniform2fv = rlNullUniform2fv;
+    glad_glUniform3fv = rlNullUniform3fv;
+    glad_glUniform4fv = rlNullUniform4fv;
+    glad_glUniform1iv = rlNullUniform1iv;
+    glad_glUniform2iv = rlNullUniform2iv;
+    glad_glUniform3iv = rlNullUniform3iv;
+    glad_glUniform4iv = rlNullUniform4iv;
+    glad_glUniformMatrix4fv = rlNullUniformMatrix4fv;
+    glad_glVertexAttrib1fv = rlNullVertexAttrib1fv;
+    glad_glVertexAttrib2fv = rlNullVertexAttrib2fv;
+    glad_glVertexAttrib3fv = rlNullVertexAttrib3fv;
+    glad_glVertexAttrib4fv = rlNullVertexAttrib4fv;
+    glad_glMapBufferRange = rlNullMapBufferRange;
+    glad_glUnmapBuffer = rlNullUnmapBuffer;
+
+    glad_glClear = rlNullClear;
+    glad_glBlitFramebuffer = rlNullBlitFramebuffer;
+    glad_glDrawArrays = rlNullDrawArrays;
+    glad_glDrawArraysInstanced = rlNullDrawArraysInstanced;
+    glad_glDrawElements = rlNullDrawElements;
+    glad_glDrawElementsInstanced = rlNullDrawElementsInstanced;
+    glad_glMultiDrawArrays = rlNullMultiDrawArrays;
+    glad_glMultiDrawElements = rlNullMultiDrawElements;
+
+    glad_glGetTexImage = rlNullGetTexImage;
+    glad_glReadPixels = rlNullReadPixels;
+
+    glad_glGetError = rlNullGetError;
+    glad_glCheckFramebufferStatus = rlNullCheckFramebufferStatus;
+    glad_glClientWaitSync = rlNullClientWaitSync;
+    glad_glGetAttribLocation = rlNullGetAttribLocation;
+    glad_glGetUniformLocation = rlNullGetUniformLocation;
+    glad_glGetFloatv = rlNullGetFloatv;
+    glad_glGetIntegerv = rlNullGetIntegerv;
+    glad_glGetFramebufferAttachmentParameteriv = rlNullGetFramebufferAttachmentParameteriv;
+    glad_glGetProgramiv = rlNullGetProgramiv;
+    glad_glGetShaderiv = rlNullGetShaderiv;
+    glad_glGetProgramInfoLog = rlNullGetProgramInfoLog;
+    glad_glGetShaderInfoLog = rlNullGetShaderInfoLog;
+    glad_glGetString = rlNullGetString;
+    glad_glGetStringi = rlNullGetStringi;
+}
+#endif  // GRAPHICS_API_NULL
+
 // Auxiliar math functions
 
 // Get identity matrix
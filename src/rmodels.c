@@ -57,6 +57,7 @@
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <float.h>          // Required for: FLT_MAX
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -130,13 +131,29 @@
     #define MAX_MATERIAL_MAPS       12    // Maximum number of maps supported
 #endif
 #ifndef MAX_MESH_VERTEX_BUFFERS
-    #define MAX_MESH_VERTEX_BUFFERS  7    // Maximum vertex buffers (VBO) per mesh
+    #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
+#endif
+#ifndef MESH_BVH_LEAF_TRIANGLES
+    #define MESH_BVH_LEAF_TRIANGLES  4    // Maximum triangles per mesh BVH leaf (before SAH split is evaluated)
+#endif
+#ifndef MESH_BVH_SAH_BINS
+    #define MESH_BVH_SAH_BINS       16    // Mesh BVH surface area heuristic bins per axis
+#endif
+#ifndef MESH_BVH_MAX_DEPTH
+    #define MESH_BVH_MAX_DEPTH      64    // Mesh BVH maximum depth (traversal stack size)
 #endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Mesh BVH building data
+typedef struct MeshBVHBuilder {
+    MeshBVHNode *nodes;         // Nodes array, up to 2*triangleCount - 1 nodes
+    int nodeCount;              // Nodes allocated
+    BoundingBox *bounds;        // Triangles bounds
+    Vector3 *centroids;         // Triangles bounds centroids
+    int *indices;               // Triangles indices, sorted by leaf while building
+} MeshBVHBuilder;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -167,6 +184,11 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
+static void BuildMeshBVHNode(MeshBVHBuilder *builder, int nodeIndex, int first, int count, int depth);  // Build mesh BVH node (recursive)
+static float GetBoundingBoxArea(BoundingBox box);  // Get bounding box surface area
+static float GetRayBoxDistance(Vector3 position, Vector3 invDirection, BoundingBox box, float maxDistance);  // Get ray entry distance into box, -1 if missed
+static Ray GetRayMeshSpace(Ray ray, Matrix invTransform);  // Get ray transformed into mesh space
+static RayCollision GetRayCollisionWorldSpace(RayCollision collision, Matrix transform, Matrix invTransform);  // Get mesh space collision transformed into world space
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1054,6 +1076,17 @@ Model LoadModel(const char *fileName)
 
     if ((model.meshCount != 0) && (model.meshes != NULL))
     {
+        // Init bone matrices to bind pose for skinned meshes (GPU skinning)
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            if ((model.boneCount > 0) && (model.meshes[i].boneWeights != NULL) && (model.meshes[i].boneMatrices == NULL))
+            {
+                model.meshes[i].boneCount = model.boneCount;
+                model.meshes[i].boneMatrices = (Matrix *)RL_MALLOC(model.boneCount*sizeof(Matrix));
+                for (int j = 0; j < model.boneCount; j++) model.meshes[i].boneMatrices[j] = MatrixIdentity();
+            }
+        }
+
         // Upload vertex data to GPU (static meshes)
         for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
     }
@@ -1190,6 +1223,8 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     mesh->vboId[4] = 0;     // Vertex buffer: tangents
     mesh->vboId[5] = 0;     // Vertex buffer: texcoords2
     mesh->vboId[6] = 0;     // Vertex buffer: indices
+    mesh->vboId[7] = 0;     // Vertex buffer: boneIds
+    mesh->vboId[8] = 0;     // Vertex buffer: boneWeights
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     mesh->vaoId = rlLoadVertexArray();
@@ -1276,6 +1311,38 @@ void UploadMesh(Mesh *mesh, bool dynamic)
         rlDisableVertexAttribute(5);
     }
 
+    if (mesh->boneIds != NULL)
+    {
+        // Enable vertex attribute: boneIds (shader-location = 6)
+        mesh->vboId[7] = rlLoadVertexBuffer(mesh->boneIds, mesh->vertexCount*4*sizeof(unsigned char), dynamic);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS, 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS);
+    }
+    else
+    {
+        // Default vertex attribute: boneIds
+        // WARNING: Default value provided to shader if location available
+        float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS, value, SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS);
+    }
+
+    if (mesh->boneWeights != NULL)
+    {
+        // Enable vertex attribute: boneWeights (shader-location = 7)
+        mesh->vboId[8] = rlLoadVertexBuffer(mesh->boneWeights, mesh->vertexCount*4*sizeof(float), dynamic);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, 4, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS);
+    }
+    else
+    {
+        // Default vertex attribute: boneWeights
+        // WARNING: Default value provided to shader if location available
+        float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, value, SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS);
+    }
+
     if (mesh->indices != NULL)
     {
         mesh->vboId[6] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), dynamic);
@@ -1378,6 +1445,9 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     // Model transformation matrix is sent to shader uniform location: SHADER_LOC_MATRIX_MODEL
     if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MODEL], transform);
 
+    // Bone matrices are sent to shader uniform location: SHADER_LOC_BONE_MATRICES (GPU skinning)
+    if ((material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1) && (mesh.boneMatrices != NULL)) rlSetUniformMatrices(material.shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
+
     // Accumulate several model transformations:
     //    transform: model transformation provided (includes DrawModel() params combined with model.transform)
     //    rlGetMatrixTransform(): rlgl internal transform matrix due to push/pop matrix stack
@@ -1467,6 +1537,22 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
         }
 
+        // Bind mesh VBO data: vertex bone ids (shader-location = 6, if available)
+        if ((material.shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1) && (mesh.vboId[7] != 0))
+        {
+            rlEnableVertexBuffer(mesh.vboId[7]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS], 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS]);
+        }
+
+        // Bind mesh VBO data: vertex bone weights (shader-location = 7, if available)
+        if ((material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1) && (mesh.vboId[8] != 0))
+        {
+            rlEnableVertexBuffer(mesh.vboId[8]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], 4, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
+        }
+
         if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
     }
 
@@ -1611,6 +1697,9 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 
     // Upload model normal matrix (if locations available)
     if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+
+    // Bone matrices are sent to shader uniform location: SHADER_LOC_BONE_MATRICES (GPU skinning)
+    if ((material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1) && (mesh.boneMatrices != NULL)) rlSetUniformMatrices(material.shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
     //-----------------------------------------------------
 
     // Bind active texture maps (if available)
@@ -1688,6 +1777,22 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
         }
 
+        // Bind mesh VBO data: vertex bone ids (shader-location = 6, if available)
+        if ((material.shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1) && (mesh.vboId[7] != 0))
+        {
+            rlEnableVertexBuffer(mesh.vboId[7]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS], 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS]);
+        }
+
+        // Bind mesh VBO data: vertex bone weights (shader-location = 7, if available)
+        if ((material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1) && (mesh.vboId[8] != 0))
+        {
+            rlEnableVertexBuffer(mesh.vboId[8]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], 4, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
+        }
+
         if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
     }
 
@@ -1768,6 +1873,7 @@ void UnloadMesh(Mesh mesh)
     RL_FREE(mesh.animNormals);
     RL_FREE(mesh.boneWeights);
     RL_FREE(mesh.boneIds);
+    RL_FREE(mesh.boneMatrices);
 }
 
 // Export mesh data to file
@@ -1992,95 +2098,143 @@ ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount)
     return animations;
 }
 
+// Update model animation mesh bone matrices for a given frame
+// NOTE: Bone matrices are computed once per bone, from bind pose to animation frame pose,
+// they are sent to shader on drawing for GPU skinning (SHADER_LOC_BONE_MATRICES)
+void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
+{
+    if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL) && (model.bindPose != NULL))
+    {
+        if (frame >= anim.frameCount) frame = frame%anim.frameCount;
+
+        // NOTE: Models not loaded from file (i.e. LoadModelFromMesh()) could provide bind pose without bones count
+        int modelBoneCount = (model.boneCount > 0)? model.boneCount : anim.boneCount;
+        int boneCount = (anim.boneCount < modelBoneCount)? anim.boneCount : modelBoneCount;
+
+        for (int m = 0; m < model.meshCount; m++)
+        {
+            Mesh *mesh = &model.meshes[m];
+
+            // Skinned meshes not initialized by LoadModel() get their bone matrices on first update
+            if ((mesh->boneMatrices == NULL) && (mesh->boneIds != NULL) && (mesh->boneWeights != NULL) && (modelBoneCount > 0))
+            {
+                mesh->boneCount = modelBoneCount;
+                mesh->boneMatrices = (Matrix *)RL_MALLOC(modelBoneCount*sizeof(Matrix));
+                for (int j = 0; j < modelBoneCount; j++) mesh->boneMatrices[j] = MatrixIdentity();
+            }
+
+            if ((mesh->boneMatrices == NULL) || (mesh->boneCount <= 0)) continue;
+
+            // Compute bone matrices for first mesh, copy them for next meshes
+            if (m > 0)
+            {
+                Mesh *firstMesh = NULL;
+                for (int k = 0; k < m; k++) if ((model.meshes[k].boneMatrices != NULL) && (model.meshes[k].boneCount == mesh->boneCount)) { firstMesh = &model.meshes[k]; break; }
+
+                if (firstMesh != NULL)
+                {
+                    memcpy(mesh->boneMatrices, firstMesh->boneMatrices, mesh->boneCount*sizeof(Matrix));
+                    continue;
+                }
+            }
+
+            for (int boneId = 0; (boneId < boneCount) && (boneId < mesh->boneCount); boneId++)
+            {
+                Vector3 inTranslation = model.bindPose[boneId].translation;
+                Quaternion inRotation = model.bindPose[boneId].rotation;
+                Vector3 outTranslation = anim.framePoses[frame][boneId].translation;
+                Quaternion outRotation = anim.framePoses[frame][boneId].rotation;
+                Vector3 outScale = anim.framePoses[frame][boneId].scale;
+
+                // Same transformation than CPU skinning: translate to bone origin, scale, rotate and translate to animated bone position
+                Matrix boneMatrix = MatrixTranslate(-inTranslation.x, -inTranslation.y, -inTranslation.z);
+                boneMatrix = MatrixMultiply(boneMatrix, MatrixScale(outScale.x, outScale.y, outScale.z));
+                boneMatrix = MatrixMultiply(boneMatrix, QuaternionToMatrix(QuaternionMultiply(outRotation, QuaternionInvert(inRotation))));
+                boneMatrix = MatrixMultiply(boneMatrix, MatrixTranslate(outTranslation.x, outTranslation.y, outTranslation.z));
+
+                mesh->boneMatrices[boneId] = boneMatrix;
+            }
+        }
+    }
+}
+
 // Update model animated vertex data (positions and normals) for a given frame
-// NOTE: Updated data is uploaded to GPU
+// NOTE: Bone matrices are computed once per frame (see UpdateModelAnimationBones()) and blended per vertex,
+// updated data is uploaded to GPU
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
     if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
     {
-        if (frame >= anim.frameCount) frame = frame%anim.frameCount;
+        // NOTE: Bone matrices are allocated on first update if mesh did not have them (CPU skinning)
+        UpdateModelAnimationBones(model, anim, frame);
 
         for (int m = 0; m < model.meshCount; m++)
         {
             Mesh mesh = model.meshes[m];
 
-            if (mesh.boneIds == NULL || mesh.boneWeights == NULL)
+            if ((mesh.boneIds == NULL) || (mesh.boneWeights == NULL) || (mesh.boneMatrices == NULL))
             {
                 TRACELOG(LOG_WARNING, "MODEL: UpdateModelAnimation(): Mesh %i has no connection to bones", m);
                 continue;
             }
 
             bool updated = false;           // Flag to check when anim vertex information is updated
-            Vector3 animVertex = { 0 };
-            Vector3 animNormal = { 0 };
-
-            Vector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
-            // Vector3 inScale = { 0 };
 
-            Vector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
-            Vector3 outScale = { 0 };
-
-            int boneId = 0;
-            int boneCounter = 0;
-            float boneWeight = 0.0;
-
-            const int vValues = mesh.vertexCount*3;
-            for (int vCounter = 0; vCounter < vValues; vCounter += 3)
+            for (int v = 0; v < mesh.vertexCount; v++)
             {
-                mesh.animVertices[vCounter] = 0;
-                mesh.animVertices[vCounter + 1] = 0;
-                mesh.animVertices[vCounter + 2] = 0;
+                // Blend up to 4 bone matrices by weight (linear blend skinning)
+                // NOTE: Only rotation, scale and translation rows are required (12 values)
+                float blend[12] = { 0 };
+                bool skinned = false;
 
-                if (mesh.animNormals != NULL)
+                for (int j = 0; j < 4; j++)
                 {
-                    mesh.animNormals[vCounter] = 0;
-                    mesh.animNormals[vCounter + 1] = 0;
-                    mesh.animNormals[vCounter + 2] = 0;
-                }
-
-                // Iterates over 4 bones per vertex
-                for (int j = 0; j < 4; j++, boneCounter++)
-                {
-                    boneWeight = mesh.boneWeights[boneCounter];
+                    float boneWeight = mesh.boneWeights[v*4 + j];
 
                     // Early stop when no transformation will be applied
                     if (boneWeight == 0.0f) continue;
 
-                    boneId = mesh.boneIds[boneCounter];
-                    //int boneIdParent = model.bones[boneId].parent;
-                    inTranslation = model.bindPose[boneId].translation;
-                    inRotation = model.bindPose[boneId].rotation;
-                    //inScale = model.bindPose[boneId].scale;
-                    outTranslation = anim.framePoses[frame][boneId].translation;
-                    outRotation = anim.framePoses[frame][boneId].rotation;
-                    outScale = anim.framePoses[frame][boneId].scale;
-
-                    // Vertices processing
-                    // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
-                    animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                    animVertex = Vector3Subtract(animVertex, inTranslation);
-                    animVertex = Vector3Multiply(animVertex, outScale);
-                    animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                    animVertex = Vector3Add(animVertex, outTranslation);
-                    //animVertex = Vector3Transform(animVertex, model.transform);
-                    mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                    mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
-                    mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
-                    updated = true;
-
-                    // Normals processing
-                    // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                    if (mesh.normals != NULL)
+                    int boneId = mesh.boneIds[v*4 + j];
+                    if (boneId >= mesh.boneCount) continue;
+
+                    const float *boneMatrix = (const float *)&mesh.boneMatrices[boneId];
+                    for (int k = 0; k < 12; k++) blend[k] += boneMatrix[k]*boneWeight;
+                    skinned = true;
+                }
+
+                // NOTE: Matrix struct is stored by rows: m0, m4, m8, m12, m1, m5...
+                float x = mesh.vertices[v*3];
+                float y = mesh.vertices[v*3 + 1];
+                float z = mesh.vertices[v*3 + 2];
+                mesh.animVertices[v*3] = blend[0]*x + blend[1]*y + blend[2]*z + blend[3];
+                mesh.animVertices[v*3 + 1] = blend[4]*x + blend[5]*y + blend[6]*z + blend[7];
+                mesh.animVertices[v*3 + 2] = blend[8]*x + blend[9]*y + blend[10]*z + blend[11];
+
+                if ((mesh.normals != NULL) && (mesh.animNormals != NULL))
+                {
+                    x = mesh.normals[v*3];
+                    y = mesh.normals[v*3 + 1];
+                    z = mesh.normals[v*3 + 2];
+                    float nx = blend[0]*x + blend[1]*y + blend[2]*z;
+                    float ny = blend[4]*x + blend[5]*y + blend[6]*z;
+                    float nz = blend[8]*x + blend[9]*y + blend[10]*z;
+
+                    // Renormalize, scaled bones (or blended rotations) change normal length
+                    float length = sqrtf(nx*nx + ny*ny + nz*nz);
+                    if (length > 0.0f)
                     {
-                        animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                        animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                        mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                        mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                        mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
+                        float ilength = 1.0f/length;
+                        nx *= ilength;
+                        ny *= ilength;
+                        nz *= ilength;
                     }
+
+                    mesh.animNormals[v*3] = nx;
+                    mesh.animNormals[v*3 + 1] = ny;
+                    mesh.animNormals[v*3 + 2] = nz;
                 }
+
+                if (skinned) updated = true;
             }
 
             // Upload new vertex data to GPU for model drawing
@@ -3408,6 +3562,68 @@ void GenMeshTangents(Mesh *mesh)
     TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
 }
 
+// Load mesh bounding volume hierarchy (SAH build) for fast ray collision
+// NOTE: Mesh vertex data must be available on CPU, triangles positions are copied (sorted by leaf),
+// so BVH is independent of mesh and must be rebuilt if mesh vertices are modified
+MeshBVH LoadMeshBVH(Mesh mesh)
+{
+    MeshBVH bvh = { 0 };
+
+    if ((mesh.vertices == NULL) || (mesh.triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to load BVH, vertex data not available on CPU");
+        return bvh;
+    }
+
+    int triangleCount = mesh.triangleCount;
+    Vector3 *vertices = (Vector3 *)mesh.vertices;
+    Vector3 *triangles = (Vector3 *)RL_MALLOC(triangleCount*3*sizeof(Vector3));
+
+    // Get triangles positions, bounds and centroids
+    MeshBVHBuilder builder = { 0 };
+    builder.nodes = (MeshBVHNode *)RL_MALLOC((2*triangleCount - 1)*sizeof(MeshBVHNode));
+    builder.bounds = (BoundingBox *)RL_MALLOC(triangleCount*sizeof(BoundingBox));
+    builder.centroids = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+    builder.indices = (int *)RL_MALLOC(triangleCount*sizeof(int));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        for (int k = 0; k < 3; k++) triangles[i*3 + k] = (mesh.indices != NULL)? vertices[mesh.indices[i*3 + k]] : vertices[i*3 + k];
+
+        builder.bounds[i].min = Vector3Min(Vector3Min(triangles[i*3], triangles[i*3 + 1]), triangles[i*3 + 2]);
+        builder.bounds[i].max = Vector3Max(Vector3Max(triangles[i*3], triangles[i*3 + 1]), triangles[i*3 + 2]);
+        builder.centroids[i] = Vector3Scale(Vector3Add(builder.bounds[i].min, builder.bounds[i].max), 0.5f);
+        builder.indices[i] = i;
+    }
+
+    builder.nodeCount = 1;
+    BuildMeshBVHNode(&builder, 0, 0, triangleCount, 0);
+
+    // Store triangles sorted by leaf, so every leaf triangles are contiguous in memory
+    bvh.triangleCount = triangleCount;
+    bvh.vertices = (float *)RL_MALLOC(triangleCount*9*sizeof(float));
+    for (int i = 0; i < triangleCount; i++) memcpy(bvh.vertices + i*9, triangles + builder.indices[i]*3, 3*sizeof(Vector3));
+
+    bvh.nodeCount = builder.nodeCount;
+    bvh.nodes = (MeshBVHNode *)RL_REALLOC(builder.nodes, builder.nodeCount*sizeof(MeshBVHNode));
+
+    RL_FREE(triangles);
+    RL_FREE(builder.bounds);
+    RL_FREE(builder.centroids);
+    RL_FREE(builder.indices);
+
+    TRACELOG(LOG_INFO, "MESH: BVH loaded successfully (%i triangles, %i nodes)", bvh.triangleCount, bvh.nodeCount);
+
+    return bvh;
+}
+
+// Unload mesh bounding volume hierarchy
+void UnloadMeshBVH(MeshBVH bvh)
+{
+    RL_FREE(bvh.nodes);
+    RL_FREE(bvh.vertices);
+}
+
 // Draw a model (with texture if set)
 void DrawModel(Model model, Vector3 position, float scale, Color tint)
 {
@@ -3764,6 +3980,7 @@ RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
 }
 
 // Get collision info between ray and mesh
+// NOTE: Ray is transformed into mesh space, mesh vertices are tested untransformed
 RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
 {
     RayCollision collision = { 0 };
@@ -3772,12 +3989,15 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     if (mesh.vertices != NULL)
     {
         int triangleCount = mesh.triangleCount;
+        Vector3 *vertdata = (Vector3 *)mesh.vertices;
+
+        Matrix invTransform = MatrixInvert(transform);
+        Ray meshRay = GetRayMeshSpace(ray, invTransform);
 
         // Test against all triangles in mesh
         for (int i = 0; i < triangleCount; i++)
         {
             Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
 
             if (mesh.indices)
             {
@@ -3792,11 +4012,7 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
                 c = vertdata[i*3 + 2];
             }
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
-
-            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+            RayCollision triHitInfo = GetRayCollisionTriangle(meshRay, a, b, c);
 
             if (triHitInfo.hit)
             {
@@ -3804,8 +4020,77 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
                 if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
             }
         }
+
+        if (collision.hit) collision = GetRayCollisionWorldSpace(collision, transform, invTransform);
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and mesh bounding volume hierarchy
+// NOTE: Ray is transformed into mesh space, nodes are visited front to back and
+// skipped when farther than the closest hit found
+RayCollision GetRayCollisionMeshBVH(Ray ray, MeshBVH bvh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+
+    if (bvh.nodeCount <= 0) return collision;
+
+    Matrix invTransform = MatrixInvert(transform);
+    Ray meshRay = GetRayMeshSpace(ray, invTransform);
+    Vector3 invDirection = { 1.0f/meshRay.direction.x, 1.0f/meshRay.direction.y, 1.0f/meshRay.direction.z };
+    Vector3 *triangles = (Vector3 *)bvh.vertices;
+
+    float closestDistance = FLT_MAX;
+    int stack[MESH_BVH_MAX_DEPTH] = { 0 };
+    int stackCount = 0;
+    int nodeIndex = (GetRayBoxDistance(meshRay.position, invDirection, bvh.nodes[0].bounds, closestDistance) >= 0.0f)? 0 : -1;
+
+    while (nodeIndex >= 0)
+    {
+        const MeshBVHNode *node = &bvh.nodes[nodeIndex];
+
+        if (node->count > 0)
+        {
+            // Leaf node, test against all its triangles
+            for (int i = node->index; i < (node->index + node->count); i++)
+            {
+                RayCollision triHitInfo = GetRayCollisionTriangle(meshRay, triangles[i*3], triangles[i*3 + 1], triangles[i*3 + 2]);
+
+                if (triHitInfo.hit && (triHitInfo.distance < closestDistance))
+                {
+                    closestDistance = triHitInfo.distance;
+                    collision = triHitInfo;
+                }
+            }
+
+            nodeIndex = (stackCount > 0)? stack[--stackCount] : -1;
+        }
+        else
+        {
+            // Inner node, visit nearest child first, farthest later (if still required)
+            int nearIndex = nodeIndex + 1;
+            int farIndex = node->index;
+            float nearDistance = GetRayBoxDistance(meshRay.position, invDirection, bvh.nodes[nearIndex].bounds, closestDistance);
+            float farDistance = GetRayBoxDistance(meshRay.position, invDirection, bvh.nodes[farIndex].bounds, closestDistance);
+
+            if ((farDistance >= 0.0f) && ((nearDistance < 0.0f) || (farDistance < nearDistance)))
+            {
+                int index = nearIndex; nearIndex = farIndex; farIndex = index;
+                float distance = nearDistance; nearDistance = farDistance; farDistance = distance;
+            }
+
+            if (nearDistance < 0.0f) nodeIndex = (stackCount > 0)? stack[--stackCount] : -1;
+            else
+            {
+                if (farDistance >= 0.0f) stack[stackCount++] = farIndex;
+                nodeIndex = nearIndex;
+            }
+        }
     }
 
+    if (collision.hit) collision = GetRayCollisionWorldSpace(collision, transform, invTransform);
+
     return collision;
 }
 
@@ -3885,6 +4170,199 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Get bounding box surface area, used by SAH (surface area heuristic)
+static float GetBoundingBoxArea(BoundingBox box)
+{
+    Vector3 size = Vector3Subtract(box.max, box.min);
+
+    return 2.0f*(size.x*size.y + size.y*size.z + size.z*size.x);
+}
+
+// Build mesh BVH node (recursive)
+// NOTE: Node is split using binned SAH on centroids bounds, first child is stored
+// right after node and second child after first child subtree (depth-first order)
+static void BuildMeshBVHNode(MeshBVHBuilder *builder, int nodeIndex, int first, int count, int depth)
+{
+    MeshBVHNode *node = &builder->nodes[nodeIndex];
+    BoundingBox centroidBounds = { builder->centroids[builder->indices[first]], builder->centroids[builder->indices[first]] };
+
+    node->bounds = builder->bounds[builder->indices[first]];
+    node->index = first;
+    node->count = count;
+
+    for (int i = first + 1; i < (first + count); i++)
+    {
+        int triangle = builder->indices[i];
+        node->bounds.min = Vector3Min(node->bounds.min, builder->bounds[triangle].min);
+        node->bounds.max = Vector3Max(node->bounds.max, builder->bounds[triangle].max);
+        centroidBounds.min = Vector3Min(centroidBounds.min, builder->centroids[triangle]);
+        centroidBounds.max = Vector3Max(centroidBounds.max, builder->centroids[triangle]);
+    }
+
+    if ((count <= MESH_BVH_LEAF_TRIANGLES) || (depth >= (MESH_BVH_MAX_DEPTH - 1))) return;
+
+    // Find lowest cost split plane between bins along every axis
+    float bestCost = FLT_MAX;
+    int bestAxis = -1;
+    int bestSplit = 0;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float boundsMin = ((float *)&centroidBounds.min)[axis];
+        float extent = ((float *)&centroidBounds.max)[axis] - boundsMin;
+        if (extent <= 0.0f) continue;
+
+        BoundingBox binBounds[MESH_BVH_SAH_BINS] = { 0 };
+        int binCount[MESH_BVH_SAH_BINS] = { 0 };
+        float binScale = MESH_BVH_SAH_BINS/extent;
+
+        for (int i = first; i < (first + count); i++)
+        {
+            int triangle = builder->indices[i];
+            int bin = (int)((((float *)&builder->centroids[triangle])[axis] - boundsMin)*binScale);
+            if (bin > (MESH_BVH_SAH_BINS - 1)) bin = MESH_BVH_SAH_BINS - 1;
+
+            if (binCount[bin] == 0) binBounds[bin] = builder->bounds[triangle];
+            else
+            {
+                binBounds[bin].min = Vector3Min(binBounds[bin].min, builder->bounds[triangle].min);
+                binBounds[bin].max = Vector3Max(binBounds[bin].max, builder->bounds[triangle].max);
+            }
+
+            binCount[bin]++;
+        }
+
+        // Sweep bins from left to right and right to left accumulating bounds areas
+        float leftArea[MESH_BVH_SAH_BINS - 1] = { 0 };
+        int leftCount[MESH_BVH_SAH_BINS - 1] = { 0 };
+        BoundingBox bounds = { 0 };
+        int boundsCount = 0;
+
+        for (int bin = 0; bin < (MESH_BVH_SAH_BINS - 1); bin++)
+        {
+            if (binCount[bin] > 0)
+            {
+                if (boundsCount == 0) bounds = binBounds[bin];
+                else bounds = (BoundingBox){ Vector3Min(bounds.min, binBounds[bin].min), Vector3Max(bounds.max, binBounds[bin].max) };
+                boundsCount += binCount[bin];
+            }
+
+            leftCount[bin] = boundsCount;
+            leftArea[bin] = (boundsCount > 0)? GetBoundingBoxArea(bounds) : 0.0f;
+        }
+
+        boundsCount = 0;
+
+        for (int bin = MESH_BVH_SAH_BINS - 1; bin > 0; bin--)
+        {
+            if (binCount[bin] > 0)
+            {
+                if (boundsCount == 0) bounds = binBounds[bin];
+                else bounds = (BoundingBox){ Vector3Min(bounds.min, binBounds[bin].min), Vector3Max(bounds.max, binBounds[bin].max) };
+                boundsCount += binCount[bin];
+            }
+
+            if ((leftCount[bin - 1] == 0) || (boundsCount == 0)) continue;
+
+            float cost = leftCount[bin - 1]*leftArea[bin - 1] + boundsCount*GetBoundingBoxArea(bounds);
+
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = bin;
+            }
+        }
+    }
+
+    // Keep node as leaf if no split is cheaper than testing all its triangles
+    if ((bestAxis < 0) || (bestCost >= count*GetBoundingBoxArea(node->bounds))) return;
+
+    // Partition triangles indices by split plane
+    float boundsMin = ((float *)&centroidBounds.min)[bestAxis];
+    float binScale = MESH_BVH_SAH_BINS/(((float *)&centroidBounds.max)[bestAxis] - boundsMin);
+    int i = first;
+    int j = first + count - 1;
+
+    while (i <= j)
+    {
+        int bin = (int)((((float *)&builder->centroids[builder->indices[i]])[bestAxis] - boundsMin)*binScale);
+        if (bin > (MESH_BVH_SAH_BINS - 1)) bin = MESH_BVH_SAH_BINS - 1;
+
+        if (bin < bestSplit) i++;
+        else
+        {
+            int index = builder->indices[i];
+            builder->indices[i] = builder->indices[j];
+            builder->indices[j--] = index;
+        }
+    }
+
+    int leftCount = i - first;
+    if ((leftCount == 0) || (leftCount == count)) return;
+
+    node->count = 0;
+
+    int leftIndex = builder->nodeCount++;
+    BuildMeshBVHNode(builder, leftIndex, first, leftCount, depth + 1);
+
+    int rightIndex = builder->nodeCount++;
+    builder->nodes[nodeIndex].index = rightIndex;
+    BuildMeshBVHNode(builder, rightIndex, i, count - leftCount, depth + 1);
+}
+
+// Get ray entry distance into box, -1 if missed or farther than maxDistance
+// NOTE: Distance is 0 if ray position is inside the box
+static float GetRayBoxDistance(Vector3 position, Vector3 invDirection, BoundingBox box, float maxDistance)
+{
+    float tx1 = (box.min.x - position.x)*invDirection.x;
+    float tx2 = (box.max.x - position.x)*invDirection.x;
+    float ty1 = (box.min.y - position.y)*invDirection.y;
+    float ty2 = (box.max.y - position.y)*invDirection.y;
+    float tz1 = (box.min.z - position.z)*invDirection.z;
+    float tz2 = (box.max.z - position.z)*invDirection.z;
+
+    float tmin = fmaxf(fmaxf(fminf(tx1, tx2), fminf(ty1, ty2)), fmaxf(fminf(tz1, tz2), 0.0f));
+    float tmax = fminf(fminf(fmaxf(tx1, tx2), fmaxf(ty1, ty2)), fminf(fmaxf(tz1, tz2), maxDistance));
+
+    return (tmin <= tmax)? tmin : -1.0f;
+}
+
+// Get ray transformed into mesh space
+// NOTE: Direction is not normalized, so distances along the ray are the same in mesh and world space
+static Ray GetRayMeshSpace(Ray ray, Matrix invTransform)
+{
+    Ray meshRay = { 0 };
+
+    meshRay.position = Vector3Transform(ray.position, invTransform);
+    meshRay.direction.x = invTransform.m0*ray.direction.x + invTransform.m4*ray.direction.y + invTransform.m8*ray.direction.z;
+    meshRay.direction.y = invTransform.m1*ray.direction.x + invTransform.m5*ray.direction.y + invTransform.m9*ray.direction.z;
+    meshRay.direction.z = invTransform.m2*ray.direction.x + invTransform.m6*ray.direction.y + invTransform.m10*ray.direction.z;
+
+    return meshRay;
+}
+
+// Get mesh space collision transformed into world space
+// NOTE: Normal is transformed by inverse transpose, and flipped if transform mirrors triangles winding
+static RayCollision GetRayCollisionWorldSpace(RayCollision collision, Matrix transform, Matrix invTransform)
+{
+    Vector3 normal = collision.normal;
+
+    collision.point = Vector3Transform(collision.point, transform);
+    collision.normal.x = invTransform.m0*normal.x + invTransform.m1*normal.y + invTransform.m2*normal.z;
+    collision.normal.y = invTransform.m4*normal.x + invTransform.m5*normal.y + invTransform.m6*normal.z;
+    collision.normal.z = invTransform.m8*normal.x + invTransform.m9*normal.y + invTransform.m10*normal.z;
+
+    float det = transform.m0*(transform.m5*transform.m10 - transform.m9*transform.m6) -
+                transform.m4*(transform.m1*transform.m10 - transform.m9*transform.m2) +
+                transform.m8*(transform.m1*transform.m6 - transform.m5*transform.m2);
+    if (det < 0.0f) collision.normal = Vector3Negate(collision.normal);
+
+    collision.normal = Vector3Normalize(collision.normal);
+
+    return collision;
+}
+
 #if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
 // Build pose from parent joints
 // NOTE: Required for animations loading (required by IQM and GLTF)
@@ -12,6 +12,7 @@
 *
 *       #define SUPPORT_FILEFORMAT_FNT
 *       #define SUPPORT_FILEFORMAT_TTF
+*       #define SUPPORT_FILEFORMAT_RFNT
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, just comment unrequired #define in this module
 *
@@ -101,11 +102,103 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef FONT_CACHE_PAGE_SIZE
+    #define FONT_CACHE_PAGE_SIZE                 512        // Dynamic font glyph cache atlas page size (width and height)
+#endif
+#ifndef FONT_CACHE_MAX_PAGES
+    #define FONT_CACHE_MAX_PAGES                   4        // Dynamic font glyph cache maximum atlas pages, least recently used glyphs evicted when full
+#endif
+#ifndef FONT_TASK_GLYPHS
+    #define FONT_TASK_GLYPHS                      16        // Glyphs rasterized per task: LoadFontData() with tasks dispatcher
+#endif
+#ifndef RFNT_MAX_ATLAS_SIZE
+    #define RFNT_MAX_ATLAS_SIZE                16384        // Font cache file (.rfnt) maximum atlas width and height
+#endif
+
+#define SDF_DISTANCE_INF                       1e20f        // Distance transform infinite distance (no edge pixels): GenGlyphSDF()
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Dynamic font glyph cache, glyphs rasterized on demand into atlas pages
+// NOTE: Atlas pages are split in uniform cells (one glyph per cell) fitting the font bounding box,
+// slot i is glyphs[i] and cell (i%slotsPerPage) of page (i/slotsPerPage), slot 0 keeps fallback glyph '?'
+typedef struct GlyphCache {
+    unsigned char *fileData;        // Font file data, required by font info while font is loaded
+    stbtt_fontinfo fontInfo;        // Font info used to rasterize glyphs
+    int fontSize;                   // Font size used to rasterize glyphs
+    GlyphInfo *glyphs;              // Glyphs info data (shared with font)
+    Rectangle *recs;                // Glyphs rectangles in atlas pages (shared with font)
+    int cellWidth;                  // Atlas cell width, including padding
+    int cellHeight;                 // Atlas cell height, including padding
+    int padding;                    // Padding around glyphs in atlas cells
+    int columns;                    // Atlas cells per page row
+    int slotsPerPage;               // Atlas cells per page
+    int usedSlots;                  // Glyph slots used, reused by eviction once all pages are full
+    Texture2D pages[FONT_CACHE_MAX_PAGES];  // Atlas pages textures
+    int pageCount;                  // Atlas pages loaded
+    int filter;                     // Atlas pages texture filter (TextureFilter), applied to new pages
+    int *prev;                      // Least recently used list, previous slot (-1: none)
+    int *next;                      // Least recently used list, next slot (-1: none)
+    int head;                       // Most recently used slot
+    int tail;                       // Least recently used slot, first one to evict
+    unsigned char *cellData;        // Atlas cell pixel data, used to update pages (GRAY_ALPHA)
+} GlyphCache;
+
+// Font glyphs loading tasks data, every task rasterizes a range of FONT_TASK_GLYPHS glyphs
+typedef struct GlyphLoadTasks {
+    const stbtt_fontinfo *fontInfo; // Font info used to rasterize glyphs (read-only)
+    int fontSize;                   // Font size used to rasterize glyphs
+    const int *codepoints;          // Codepoints to load
+    int codepointCount;             // Codepoints count
+    int type;                       // Font type (FONT_DEFAULT, FONT_BITMAP, FONT_SDF)
+    GlyphInfo *glyphs;              // Glyphs info data (output)
+} GlyphLoadTasks;
+#else
+typedef struct GlyphCache GlyphCache;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+// Font cache file header (.rfnt), prebaked font: metrics, glyphs and atlas pixel data
+// NOTE: File layout: header, glyphs (glyphCount*rFontCacheGlyph), atlas data (atlasDataSize bytes)
+typedef struct rFontCacheHeader {
+    char id[4];                     // File identifier: "rFNT"
+    int version;                    // File format version: 100
+    int baseSize;                   // Font base size
+    int glyphCount;                 // Font glyphs count
+    int glyphPadding;               // Font glyphs padding in atlas
+    int atlasWidth;                 // Atlas image width
+    int atlasHeight;                // Atlas image height
+    int atlasFormat;                // Atlas image pixel format (PixelFormat type)
+    int atlasDataSize;              // Atlas data size stored in file
+    int compressed;                 // Atlas data compression: 0-None, 1-DEFLATE [CompressData()]
+} rFontCacheHeader;
+
+// Font cache file glyph data (.rfnt)
+typedef struct rFontCacheGlyph {
+    int value;                      // Glyph codepoint
+    int offsetX;                    // Glyph drawing offset X
+    int offsetY;                    // Glyph drawing offset Y
+    int advanceX;                   // Glyph advance position X
+    Rectangle rec;                  // Glyph rectangle in atlas
+} rFontCacheGlyph;
+#endif
+
+// Font glyphs lookup by codepoint, built on font loading
+// NOTE: Basic Multilingual Plane codepoints (< 0x10000) are mapped with a two-level table,
+// pages of 256 codepoints only allocated when they contain glyphs, other codepoints
+// are mapped with an open addressing hash table (linear probing)
+struct rGlyphLookup {
+    const GlyphInfo *glyphs;        // Glyphs array the lookup was built for
+    int glyphCount;                 // Glyphs count the lookup was built for
+    int fallbackIndex;              // Fallback glyph index, '?' if available
+    int *pages[256];                // BMP pages, entries store glyph index + 1 (0: glyph not available)
+    int *hashCodepoints;            // Hash table codepoints (keys)
+    int *hashIndices;               // Hash table glyph indices (values), -1 for empty slots
+    int hashSize;                   // Hash table size (power of two), 0 if not required
+    GlyphCache *cache;              // Dynamic font glyph cache, NULL for fonts with all glyphs loaded
+};
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -127,6 +220,24 @@ static Font defaultFont = { 0 };
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode font file)
 #endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+static Font LoadRFNT(const unsigned char *fileData, int dataSize);  // Load a font cache file data (prebaked font)
+#endif
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount);  // Load glyphs lookup by codepoint
+static void UnloadGlyphLookup(rGlyphLookup *lookup);                            // Unload glyphs lookup
+static void InitGlyphLookupHash(rGlyphLookup *lookup, int entryCount);          // Init glyphs lookup hash table for extended codepoints
+static int FindGlyphLookup(const rGlyphLookup *lookup, int codepoint);          // Find glyph index for codepoint, -1 if not available
+static void SetGlyphLookup(rGlyphLookup *lookup, int codepoint, int index);     // Set glyph index for codepoint, -1 to remove it
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static GlyphInfo LoadGlyphFromFontInfo(const stbtt_fontinfo *fontInfo, int fontSize, int codepoint, int type);  // Load glyph info and image for a codepoint
+static void LoadGlyphsTask(void *data, int index);                              // Load glyphs range task (LoadFontData())
+static unsigned char *GenGlyphSDF(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int padding, unsigned char onEdgeValue, float pixelDistScale, int *width, int *height, int *offsetX, int *offsetY);  // Generate glyph SDF image
+static void DistanceTransform1D(const float *f, int n, float *d, int *nearest, int *v, float *z);  // Squared euclidean distance transform of a sampled function (one dimension)
+static bool LoadGlyphCachePage(GlyphCache *cache);                              // Load a new atlas page for glyph cache
+static void LoadGlyphCacheSlot(GlyphCache *cache, int codepoint, int slot);     // Load glyph into glyph cache slot (image and atlas cell)
+static int GetGlyphCacheIndex(rGlyphLookup *lookup, int codepoint);             // Get glyph index from glyph cache, loading glyph if required
+static void UnloadGlyphCache(GlyphCache *cache);                                // Unload glyph cache
+#endif
 static int textLineSpacing = 15;                // Text vertical line spacing in pixels
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -283,6 +394,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.lookup = LoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -294,6 +406,8 @@ extern void UnloadFontDefault(void)
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphLookup(defaultFont.lookup);
+    defaultFont.lookup = NULL;
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -334,6 +448,10 @@ Font LoadFont(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_FNT)
     if (IsFileExtension(fileName, ".fnt")) font = LoadBMFont(fileName);
     else
+#endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (IsFileExtension(fileName, ".rfnt")) font = LoadFontEx(fileName, 0, NULL, 0);
+    else
 #endif
     {
         Image image = LoadImage(fileName);
@@ -348,7 +466,7 @@ Font LoadFont(const char *fileName)
     }
     else
     {
-        SetTextureFilter(font.texture, TEXTURE_FILTER_POINT);    // By default, we set point filter (the best performance)
+        SetFontTextureFilter(font, TEXTURE_FILTER_POINT);        // By default, we set point filter (the best performance)
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", FONT_TTF_DEFAULT_SIZE, FONT_TTF_DEFAULT_NUMCHARS);
     }
 
@@ -499,6 +617,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.lookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -511,6 +630,11 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     char fileExtLower[16] = { 0 };
     strcpy(fileExtLower, TextToLower(fileType));
 
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    // NOTE: Font cache is prebaked, fontSize and codepoints are not used
+    if (TextIsEqual(fileExtLower, ".rfnt")) font = LoadRFNT(fileData, dataSize);
+    else
+#endif
 #if defined(SUPPORT_FILEFORMAT_TTF)
     if (TextIsEqual(fileExtLower, ".ttf") ||
         TextIsEqual(fileExtLower, ".otf"))
@@ -536,6 +660,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
             UnloadImage(atlas);
 
+            font.lookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
             TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
         }
         else font = GetFontDefault();
@@ -547,6 +673,145 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load font from file with glyphs rasterized on demand (TTF/OTF)
+// NOTE: Glyphs are rasterized the first time they are required and cached into atlas pages
+Font LoadFontDynamic(const char *fileName, int fontSize)
+{
+    Font font = { 0 };
+
+    // Loading file to memory
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        // Loading font from memory data
+        font = LoadFontDynamicFromMemory(GetFileExtension(fileName), fileData, dataSize, fontSize);
+
+        UnloadFileData(fileData);
+    }
+    else font = GetFontDefault();
+
+    return font;
+}
+
+// Load font from memory buffer with glyphs rasterized on demand, fileType refers to extension: i.e. ".ttf"
+// NOTE: Font data is copied and kept while font is loaded, glyphs are rasterized the first time they are
+// required [GetGlyphIndex()] into uniform cells of atlas pages (FONT_CACHE_PAGE_SIZE), new pages are added
+// up to FONT_CACHE_MAX_PAGES and then least recently used glyphs are evicted, font.glyphCount is the cache
+// capacity in glyphs and font.texture the first atlas page, use SetFontTextureFilter() to filter all pages
+Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    char fileExtLower[16] = { 0 };
+    strcpy(fileExtLower, TextToLower(fileType));
+
+    if ((TextIsEqual(fileExtLower, ".ttf") || TextIsEqual(fileExtLower, ".otf")) &&
+        (fileData != NULL) && (dataSize > 0) && (fontSize > 0))
+    {
+        GlyphCache *cache = (GlyphCache *)RL_CALLOC(1, sizeof(GlyphCache));
+        cache->fileData = (unsigned char *)RL_MALLOC(dataSize);
+        memcpy(cache->fileData, fileData, dataSize);
+
+        if (stbtt_InitFont(&cache->fontInfo, cache->fileData, 0))
+        {
+            float scaleFactor = stbtt_ScaleForPixelHeight(&cache->fontInfo, (float)fontSize);
+
+            int x0, y0, x1, y1;
+            stbtt_GetFontBoundingBox(&cache->fontInfo, &x0, &y0, &x1, &y1);
+
+            // Atlas cells fit any glyph inside font bounding box, including space character image
+            cache->fontSize = fontSize;
+            cache->padding = FONT_TTF_DEFAULT_CHARS_PADDING;
+            cache->filter = TEXTURE_FILTER_POINT;
+            cache->cellWidth = (int)((float)(x1 - x0)*scaleFactor) + 2 + 2*cache->padding;
+            cache->cellHeight = (int)((float)(y1 - y0)*scaleFactor) + 2;
+            if (cache->cellHeight < fontSize) cache->cellHeight = fontSize;
+            cache->cellHeight += 2*cache->padding;
+
+            cache->columns = FONT_CACHE_PAGE_SIZE/cache->cellWidth;
+            int rows = FONT_CACHE_PAGE_SIZE/cache->cellHeight;
+            if (cache->columns < 1) cache->columns = 1;
+            if (rows < 1) rows = 1;
+            cache->slotsPerPage = cache->columns*rows;
+
+            int glyphCount = cache->slotsPerPage*FONT_CACHE_MAX_PAGES;
+
+            cache->glyphs = (GlyphInfo *)RL_CALLOC(glyphCount, sizeof(GlyphInfo));
+            cache->recs = (Rectangle *)RL_CALLOC(glyphCount, sizeof(Rectangle));
+            cache->prev = (int *)RL_MALLOC(glyphCount*sizeof(int));
+            cache->next = (int *)RL_MALLOC(glyphCount*sizeof(int));
+            for (int i = 0; i < glyphCount; i++) cache->prev[i] = cache->next[i] = -1;
+            cache->head = -1;
+            cache->tail = -1;
+            cache->cellData = (unsigned char *)RL_MALLOC(cache->cellWidth*cache->cellHeight*2);
+
+            if (LoadGlyphCachePage(cache))
+            {
+                rGlyphLookup *lookup = (rGlyphLookup *)RL_CALLOC(1, sizeof(rGlyphLookup));
+                lookup->glyphs = cache->glyphs;
+                lookup->glyphCount = glyphCount;
+                lookup->fallbackIndex = 0;
+                lookup->cache = cache;
+                InitGlyphLookupHash(lookup, glyphCount);
+
+                // Fallback glyph '?' is always available on first slot
+                LoadGlyphCacheSlot(cache, 63, 0);
+                SetGlyphLookup(lookup, 63, 0);
+                cache->usedSlots = 1;
+
+                font.baseSize = fontSize;
+                font.glyphCount = glyphCount;
+                font.glyphPadding = cache->padding;
+                font.texture = cache->pages[0];
+                font.recs = cache->recs;
+                font.glyphs = cache->glyphs;
+                font.lookup = lookup;
+
+                TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | %i glyphs cache)", font.baseSize, font.glyphCount);
+            }
+            else
+            {
+                RL_FREE(cache->glyphs);
+                RL_FREE(cache->recs);
+                UnloadGlyphCache(cache);
+            }
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
+            UnloadGlyphCache(cache);
+        }
+    }
+#endif
+
+    if (font.texture.id == 0) font = GetFontDefault();
+
+    return font;
+}
+
+// Set font texture filter
+// NOTE: Dynamic fonts filter is applied to all glyph cache atlas pages, including pages loaded later,
+// atlas pages are updated on demand so mipmaps are not available for them [GenTextureMipmaps()]
+void SetFontTextureFilter(Font font, int filter)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((font.lookup != NULL) && (font.lookup->cache != NULL))
+    {
+        GlyphCache *cache = font.lookup->cache;
+
+        cache->filter = filter;
+        for (int i = 0; i < cache->pageCount; i++) SetTextureFilter(cache->pages[i], filter);
+
+        return;
+    }
+#endif
+
+    SetTextureFilter(font.texture, filter);
+}
+
 // Check if a font is ready
 bool IsFontReady(Font font)
 {
@@ -591,14 +856,6 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
         if (stbtt_InitFont(&fontInfo, (unsigned char *)fileData, 0))     // Initialize font for data reading
         {
-            // Calculate font scale factor
-            float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
-
-            // Calculate font basic metrics
-            // NOTE: ascent is equivalent to font baseline
-            int ascent, descent, lineGap;
-            stbtt_GetFontVMetrics(&fontInfo, &ascent, &descent, &lineGap);
-
             // In case no chars count provided, default to 95
             codepointCount = (codepointCount > 0)? codepointCount : 95;
 
@@ -614,67 +871,10 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
             chars = (GlyphInfo *)RL_MALLOC(codepointCount*sizeof(GlyphInfo));
 
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < codepointCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = codepoints[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else chars[i].image.data = NULL;
-
-                stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                // Load characters images
-                chars[i].image.width = chw;
-                chars[i].image.height = chh;
-                chars[i].image.mipmaps = 1;
-                chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                chars[i].offsetY += (int)((float)ascent*scaleFactor);
-
-                // NOTE: We create an empty image for space character, it could be further required for atlas packing
-                if (ch == 32)
-                {
-                    Image imSpace = {
-                        .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                        .width = chars[i].advanceX,
-                        .height = fontSize,
-                        .mipmaps = 1,
-                        .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                    };
-
-                    chars[i].image = imSpace;
-                }
-
-                if (type == FONT_BITMAP)
-                {
-                    // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                    // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                    for (int p = 0; p < chw*chh; p++)
-                    {
-                        if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                        else ((unsigned char *)chars[i].image.data)[p] = 255;
-                    }
-                }
-
-                // Get bounding box for character (maybe offset to account for chars that dip above or below the line)
-                /*
-                int chX1, chY1, chX2, chY2;
-                stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
-
-                TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
-                TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
-                */
-            }
+            // Glyphs are rasterized independently, in parallel if a tasks dispatcher is set
+            // NOTE: stb_truetype only reads font info while rasterizing, it can be shared by tasks
+            GlyphLoadTasks tasks = { &fontInfo, fontSize, codepoints, codepointCount, type, chars };
+            RunTasks(LoadGlyphsTask, &tasks, (codepointCount + FONT_TASK_GLYPHS - 1)/FONT_TASK_GLYPHS);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -686,7 +886,7 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 }
 
 // Generate image font atlas using chars info
-// NOTE: Packing method: 0-Default, 1-Skyline
+// NOTE: Packing method: 0-Default (skyline, minimum area atlas), 1-Skyline (stb_rect_pack, power-of-two atlas)
 #if defined(SUPPORT_FILEFORMAT_TTF)
 Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod)
 {
@@ -704,111 +904,70 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
     glyphCount = (glyphCount > 0)? glyphCount : 95;
 
     // NOTE: Rectangles memory is loaded here!
-    Rectangle *recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+    Rectangle *recs = NULL;
 
-    // Calculate image size based on total glyph width and glyph row count
-    int totalWidth = 0;
-    int maxGlyphWidth = 0;
-
-    for (int i = 0; i < glyphCount; i++)
+    if (packMethod == 0)   // Use default packing, tight atlas [GenImageAtlas()]
     {
-        if (glyphs[i].image.width > maxGlyphWidth) maxGlyphWidth = glyphs[i].image.width;
-        totalWidth += glyphs[i].image.width + 4*padding;
-    }
+        Image *images = (Image *)RL_MALLOC(glyphCount*sizeof(Image));
+        for (int i = 0; i < glyphCount; i++) images[i] = glyphs[i].image;
 
-//#define SUPPORT_FONT_ATLAS_SIZE_CONSERVATIVE
-#if defined(SUPPORT_FONT_ATLAS_SIZE_CONSERVATIVE)
-    int rowCount = 0;
-    int imageSize = 64;  // Define minimum starting value to avoid unnecessary calculation steps for very small images
+        atlas = GenImageAtlas(images, glyphCount, padding, &recs);
+        RL_FREE(images);
 
-    // NOTE: maxGlyphWidth is maximum possible space left at the end of row
-    while (totalWidth > (imageSize - maxGlyphWidth)*rowCount)
-    {
-        imageSize *= 2;                                 // Double the size of image (to keep POT)
-        rowCount = imageSize/(fontSize + 2*padding);    // Calculate new row count for the new image size
-    }
+        if (atlas.data == NULL) return atlas;
 
-    atlas.width = imageSize;   // Atlas bitmap width
-    atlas.height = imageSize;  // Atlas bitmap height
-#else
-    // No need for a so-conservative atlas generation
-    float totalArea = totalWidth*fontSize*1.2f;
-    float imageMinSize = sqrtf(totalArea);
-    int imageSize = (int)powf(2, ceilf(logf(imageMinSize)/logf(2)));
+        if (atlas.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ImageFormat(&atlas, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
 
-    if (totalArea < ((imageSize*imageSize)/2))
-    {
-        atlas.width = imageSize;    // Atlas bitmap width
-        atlas.height = imageSize/2; // Atlas bitmap height
+#if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+        // Bottom-right corner is reserved for white rectangle, atlas grows if a glyph (padding included) uses it
+        bool cornerUsed = false;
+
+        for (int i = 0; i < glyphCount; i++)
+        {
+            if ((recs[i].width > 0) && ((recs[i].x + recs[i].width + padding) > (atlas.width - 3)) &&
+                ((recs[i].y + recs[i].height + padding) > (atlas.height - 3))) cornerUsed = true;
+        }
+
+        if (cornerUsed)
+        {
+            atlas.data = RL_REALLOC(atlas.data, atlas.width*(atlas.height + 3));
+            memset((unsigned char *)atlas.data + atlas.width*atlas.height, 0, atlas.width*3);
+            atlas.height += 3;
+        }
+#endif
     }
     else
     {
-        atlas.width = imageSize;   // Atlas bitmap width
-        atlas.height = imageSize;  // Atlas bitmap height
-    }
-#endif
+        recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
 
-    atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp)
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-    atlas.mipmaps = 1;
+        // Calculate image size based on total glyph width and glyph row count
+        int totalWidth = 0;
 
-    // DEBUG: We can see padding in the generated image setting a gray background...
-    //for (int i = 0; i < atlas.width*atlas.height; i++) ((unsigned char *)atlas.data)[i] = 100;
+        for (int i = 0; i < glyphCount; i++) totalWidth += glyphs[i].image.width + 4*padding;
 
-    if (packMethod == 0)   // Use basic packing algorithm
-    {
-        int offsetX = padding;
-        int offsetY = padding;
+        float totalArea = totalWidth*fontSize*1.2f;
+        float imageMinSize = sqrtf(totalArea);
+        int imageSize = (int)powf(2, ceilf(logf(imageMinSize)/logf(2)));
 
-        // NOTE: Using simple packaging, one char after another
-        for (int i = 0; i < glyphCount; i++)
+        if (totalArea < ((imageSize*imageSize)/2))
         {
-            // Check remaining space for glyph
-            if (offsetX >= (atlas.width - glyphs[i].image.width - 2*padding))
-            {
-                offsetX = padding;
-
-                // NOTE: Be careful on offsetY for SDF fonts, by default SDF
-                // use an internal padding of 4 pixels, it means char rectangle
-                // height is bigger than fontSize, it could be up to (fontSize + 8)
-                offsetY += (fontSize + 2*padding);
-
-                if (offsetY > (atlas.height - fontSize - padding))
-                {
-                    for(int j = i + 1; j < glyphCount; j++)
-                    {
-                        TRACELOG(LOG_WARNING, "FONT: Failed to package character (%i)", j);
-                        // make sure remaining recs contain valid data
-                        recs[j].x = 0;
-                        recs[j].y = 0;
-                        recs[j].width = 0;
-                        recs[j].height = 0;
-                    }
-                    break;
-                }
-            }
+            atlas.width = imageSize;    // Atlas bitmap width
+            atlas.height = imageSize/2; // Atlas bitmap height
+        }
+        else
+        {
+            atlas.width = imageSize;   // Atlas bitmap width
+            atlas.height = imageSize;  // Atlas bitmap height
+        }
 
-            // Copy pixel data from glyph image to atlas
-            for (int y = 0; y < glyphs[i].image.height; y++)
-            {
-                for (int x = 0; x < glyphs[i].image.width; x++)
-                {
-                    ((unsigned char *)atlas.data)[(offsetY + y)*atlas.width + (offsetX + x)] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
-                }
-            }
+        atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp)
+        atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+        atlas.mipmaps = 1;
 
-            // Fill chars rectangles in atlas info
-            recs[i].x = (float)offsetX;
-            recs[i].y = (float)offsetY;
-            recs[i].width = (float)glyphs[i].image.width;
-            recs[i].height = (float)glyphs[i].image.height;
+        // DEBUG: We can see padding in the generated image setting a gray background...
+        //for (int i = 0; i < atlas.width*atlas.height; i++) ((unsigned char *)atlas.data)[i] = 100;
 
-            // Move atlas position X for next character drawing
-            offsetX += (glyphs[i].image.width + 2*padding);
-        }
-    }
-    else if (packMethod == 1)  // Use Skyline rect packing algorithm (stb_pack_rect)
-    {
+        // Use Skyline rect packing algorithm (stb_pack_rect)
         stbrp_context *context = (stbrp_context *)RL_MALLOC(sizeof(*context));
         stbrp_node *nodes = (stbrp_node *)RL_MALLOC(glyphCount*sizeof(*nodes));
 
@@ -905,6 +1064,7 @@ void UnloadFont(Font font)
         UnloadFontData(font.glyphs, font.glyphCount);
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        UnloadGlyphLookup(font.lookup);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1064,6 +1224,83 @@ bool ExportFontAsCode(Font font, const char *fileName)
     return success;
 }
 
+// Export font as prebaked binary cache (.rfnt), returns true on success
+// NOTE: Font cache stores metrics, glyphs rectangles and atlas pixel data, it can be loaded with
+// LoadFont()/LoadFontFromMemory() without rasterizing glyphs or packing atlas again
+bool ExportFontCache(Font font, const char *fileName, bool compress)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if ((font.lookup != NULL) && (font.lookup->cache != NULL))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Dynamic fonts can not be exported as font cache", fileName);
+        return false;
+    }
+
+    // Get atlas pixel data back from GPU
+    Image atlas = LoadImageFromTexture(font.texture);
+    int atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+
+    rFontCacheHeader header = { 0 };
+    memcpy(header.id, "rFNT", 4);
+    header.version = 100;
+    header.baseSize = font.baseSize;
+    header.glyphCount = font.glyphCount;
+    header.glyphPadding = font.glyphPadding;
+    header.atlasWidth = atlas.width;
+    header.atlasHeight = atlas.height;
+    header.atlasFormat = atlas.format;
+    header.atlasDataSize = atlasDataSize;
+
+    unsigned char *atlasData = (unsigned char *)atlas.data;
+
+    if (compress)
+    {
+#if defined(SUPPORT_COMPRESSION_API)
+        atlasData = CompressData((const unsigned char *)atlas.data, atlasDataSize, &header.atlasDataSize);
+        header.compressed = 1;
+#else
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Compression not supported, font cache atlas data stored uncompressed", fileName);
+#endif
+    }
+
+    if ((atlas.data != NULL) && (atlasData != NULL))
+    {
+        int dataSize = sizeof(rFontCacheHeader) + font.glyphCount*sizeof(rFontCacheGlyph) + header.atlasDataSize;
+        unsigned char *fileData = (unsigned char *)RL_CALLOC(dataSize, 1);
+
+        memcpy(fileData, &header, sizeof(rFontCacheHeader));
+
+        rFontCacheGlyph *glyphs = (rFontCacheGlyph *)(fileData + sizeof(rFontCacheHeader));
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            glyphs[i].value = font.glyphs[i].value;
+            glyphs[i].offsetX = font.glyphs[i].offsetX;
+            glyphs[i].offsetY = font.glyphs[i].offsetY;
+            glyphs[i].advanceX = font.glyphs[i].advanceX;
+            glyphs[i].rec = font.recs[i];
+        }
+
+        memcpy(fileData + sizeof(rFontCacheHeader) + font.glyphCount*sizeof(rFontCacheGlyph), atlasData, header.atlasDataSize);
+
+        success = SaveFileData(fileName, fileData, dataSize);
+
+        RL_FREE(fileData);
+    }
+
+    if (atlasData != atlas.data) RL_FREE(atlasData);
+    UnloadImage(atlas);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Font cache exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export font cache", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Font cache export not supported", fileName);
+#endif
+
+    return success;
+}
+
 
 // Draw current FPS
 // NOTE: Uses default font
@@ -1171,8 +1408,18 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
     Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
                          font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
+    Texture2D texture = font.texture;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic fonts glyphs could be placed on any glyph cache atlas page
+    if ((font.lookup != NULL) && (font.lookup->cache != NULL) && (font.lookup->glyphs == font.glyphs))
+    {
+        texture = font.lookup->cache->pages[index/font.lookup->cache->slotsPerPage];
+    }
+#endif
+
     // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    DrawTexturePro(texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
 }
 
 // Draw multiple character (codepoints)
@@ -1206,6 +1453,180 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
     }
 }
 
+// Load text layout, text is shaped once (codepoints, glyphs, positions and size) to be drawn many times
+// NOTE: Layout uses font, font size, spacing and line spacing [SetTextLineSpacing()] at loading time,
+// results are the same as DrawTextEx() and MeasureTextEx() (layout.size), dynamic fonts layouts are drawn
+// by codepoint because cached glyphs could be evicted [LoadFontDynamic()]
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
+{
+    TextLayout layout = { 0 };
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+
+    layout.font = font;
+    layout.fontSize = fontSize;
+    layout.spacing = spacing;
+    layout.lineCount = 1;
+
+    if ((font.texture.id == 0) || (text == NULL)) return layout;
+
+    int size = TextLength(text);    // Total size in bytes of the text, codepoints count can not exceed it
+
+    if (size > 0)
+    {
+        layout.codepoints = (int *)RL_MALLOC(size*sizeof(int));
+        layout.glyphIndices = (int *)RL_MALLOC(size*sizeof(int));
+        layout.positions = (Vector2 *)RL_MALLOC(size*sizeof(Vector2));
+        layout.srcRecs = (Rectangle *)RL_MALLOC(size*sizeof(Rectangle));
+        layout.dstRecs = (Rectangle *)RL_MALLOC(size*sizeof(Rectangle));
+    }
+
+    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    float padding = (float)font.glyphPadding;
+
+    // Text size, measured same way as MeasureTextEx()
+    int lineCounter = 0;            // Current line codepoints count
+    int maxLineCounter = 0;         // Longer line codepoints count
+    float lineWidth = 0.0f;         // Current line width, not scaled
+    float maxLineWidth = 0.0f;      // Longer line width, not scaled
+    float textHeight = (float)font.baseSize;
+
+    for (int i = 0; i < size;)
+    {
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        int k = layout.codepointCount;
+        layout.codepoints[k] = codepoint;
+        layout.glyphIndices[k] = index;
+        layout.positions[k] = (Vector2){ textOffsetX, (float)textOffsetY };
+        layout.codepointCount++;
+
+        lineCounter++;
+
+        if (codepoint == '\n')
+        {
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textOffsetY += textLineSpacing;
+            textOffsetX = 0.0f;
+            layout.lineCount++;
+
+            if (maxLineWidth < lineWidth) maxLineWidth = lineWidth;
+            lineCounter = 0;
+            lineWidth = 0.0f;
+            textHeight += (float)textLineSpacing;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                // Glyph quad, same rectangles as DrawTextCodepoint()
+                Rectangle rec = font.recs[index];
+
+                layout.srcRecs[layout.quadCount] = (Rectangle){ rec.x - padding, rec.y - padding, rec.width + 2.0f*padding, rec.height + 2.0f*padding };
+                layout.dstRecs[layout.quadCount] = (Rectangle){ textOffsetX + font.glyphs[index].offsetX*scaleFactor - padding*scaleFactor,
+                                                                (float)textOffsetY + font.glyphs[index].offsetY*scaleFactor - padding*scaleFactor,
+                                                                (rec.width + 2.0f*padding)*scaleFactor, (rec.height + 2.0f*padding)*scaleFactor };
+                layout.quadCount++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+
+            if (font.glyphs[index].advanceX != 0) lineWidth += font.glyphs[index].advanceX;
+            else lineWidth += (font.recs[index].width + font.glyphs[index].offsetX);
+        }
+
+        if (maxLineCounter < lineCounter) maxLineCounter = lineCounter;
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+
+    if (maxLineWidth < lineWidth) maxLineWidth = lineWidth;
+
+    layout.size.x = maxLineWidth*scaleFactor + (float)((maxLineCounter - 1)*spacing);
+    layout.size.y = textHeight*scaleFactor;
+
+    return layout;
+}
+
+// Unload text layout
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.codepoints);
+    RL_FREE(layout.glyphIndices);
+    RL_FREE(layout.positions);
+    RL_FREE(layout.srcRecs);
+    RL_FREE(layout.dstRecs);
+}
+
+// Draw text layout at position
+// NOTE: Glyph quads are added to the render batch directly with a single texture bind,
+// no text decoding, glyph lookup or rectangles computation required
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    if (layout.quadCount == 0) return;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic fonts glyphs could be evicted or placed on any glyph cache atlas page, drawn by codepoint
+    if ((layout.font.lookup != NULL) && (layout.font.lookup->cache != NULL))
+    {
+        for (int i = 0; i < layout.codepointCount; i++)
+        {
+            int codepoint = layout.codepoints[i];
+
+            if ((codepoint != '\n') && (codepoint != ' ') && (codepoint != '\t'))
+            {
+                DrawTextCodepoint(layout.font, codepoint, (Vector2){ position.x + layout.positions[i].x, position.y + layout.positions[i].y }, layout.fontSize, tint);
+            }
+        }
+
+        return;
+    }
+#endif
+
+    Texture2D texture = layout.font.texture;
+    float width = (float)texture.width;
+    float height = (float)texture.height;
+
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+        for (int i = 0; i < layout.quadCount; i++)
+        {
+            Rectangle src = layout.srcRecs[i];
+            float x = position.x + layout.dstRecs[i].x;
+            float y = position.y + layout.dstRecs[i].y;
+
+            // Top-left corner for texture and quad
+            rlTexCoord2f(src.x/width, src.y/height);
+            rlVertex2f(x, y);
+
+            // Bottom-left corner for texture and quad
+            rlTexCoord2f(src.x/width, (src.y + src.height)/height);
+            rlVertex2f(x, y + layout.dstRecs[i].height);
+
+            // Bottom-right corner for texture and quad
+            rlTexCoord2f((src.x + src.width)/width, (src.y + src.height)/height);
+            rlVertex2f(x + layout.dstRecs[i].width, y + layout.dstRecs[i].height);
+
+            // Top-right corner for texture and quad
+            rlTexCoord2f((src.x + src.width)/width, src.y/height);
+            rlVertex2f(x + layout.dstRecs[i].width, y);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
 // Set vertical line spacing when drawing with line-breaks
 void SetTextLineSpacing(int spacing)
 {
@@ -1294,21 +1715,38 @@ int GetGlyphIndex(Font font, int codepoint)
 
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
-    int fallbackIndex = 0;      // Get index of fallback glyph '?'
+    rGlyphLookup *lookup = font.lookup;
 
-    // Look for character index in the unordered charset
-    for (int i = 0; i < font.glyphCount; i++)
+    // Use glyphs lookup if available and still valid for font glyphs (they could be replaced by user)
+    if ((lookup != NULL) && (lookup->glyphs == font.glyphs) && (lookup->glyphCount == font.glyphCount))
     {
-        if (font.glyphs[i].value == 63) fallbackIndex = i;
-
-        if (font.glyphs[i].value == codepoint)
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if (lookup->cache != NULL) index = GetGlyphCacheIndex(lookup, codepoint);
+        else
+#endif
         {
-            index = i;
-            break;
+            index = FindGlyphLookup(lookup, codepoint);
+            if (index < 0) index = lookup->fallbackIndex;
         }
     }
+    else
+    {
+        int fallbackIndex = 0;      // Get index of fallback glyph '?'
 
-    if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
+        // Look for character index in the unordered charset
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            if (font.glyphs[i].value == 63) fallbackIndex = i;
+
+            if (font.glyphs[i].value == codepoint)
+            {
+                index = i;
+                break;
+            }
+        }
+
+        if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
+    }
 #else
     index = codepoint - 32;
 #endif
@@ -2148,6 +2586,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(imFont);
     UnloadFileText(fileText);
 
+    font.lookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
     if (font.texture.id == 0)
     {
         UnloadFont(font);
@@ -2160,4 +2600,652 @@ static Font LoadBMFont(const char *fileName)
 }
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+// Load a font cache file data (prebaked font)
+// NOTE: Atlas data is uploaded to GPU directly from file data (or decompressed data),
+// no glyph rasterization or atlas packing required, all sizes and glyphs rectangles are validated
+static Font LoadRFNT(const unsigned char *fileData, int dataSize)
+{
+    Font font = { 0 };
+
+    rFontCacheHeader header = { 0 };
+    if ((fileData != NULL) && (dataSize >= (int)sizeof(rFontCacheHeader))) memcpy(&header, fileData, sizeof(rFontCacheHeader));
+
+    // NOTE: Sizes are checked against remaining data size before multiplying, avoiding overflows
+    int glyphsDataSize = 0;
+    bool validSize = (header.glyphCount > 0) && (header.glyphCount <= (dataSize - (int)sizeof(rFontCacheHeader))/(int)sizeof(rFontCacheGlyph));
+    if (validSize)
+    {
+        glyphsDataSize = header.glyphCount*(int)sizeof(rFontCacheGlyph);
+        validSize = (header.atlasDataSize > 0) && (header.atlasDataSize <= (dataSize - (int)sizeof(rFontCacheHeader) - glyphsDataSize));
+    }
+
+    bool validAtlas = (header.atlasWidth > 0) && (header.atlasWidth <= RFNT_MAX_ATLAS_SIZE) &&
+                      (header.atlasHeight > 0) && (header.atlasHeight <= RFNT_MAX_ATLAS_SIZE) &&
+                      (header.atlasFormat >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (header.atlasFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB);
+
+    // Check all glyphs rectangles are inside atlas
+    bool validGlyphs = validSize && validAtlas;
+    for (int i = 0; validGlyphs && (i < header.glyphCount); i++)
+    {
+        rFontCacheGlyph glyph = { 0 };
+        memcpy(&glyph, fileData + sizeof(rFontCacheHeader) + i*sizeof(rFontCacheGlyph), sizeof(rFontCacheGlyph));
+
+        validGlyphs = (glyph.rec.x >= 0.0f) && (glyph.rec.y >= 0.0f) && (glyph.rec.width >= 0.0f) && (glyph.rec.height >= 0.0f) &&
+                      ((glyph.rec.x + glyph.rec.width) <= (float)header.atlasWidth) && ((glyph.rec.y + glyph.rec.height) <= (float)header.atlasHeight);
+    }
+
+    if ((memcmp(header.id, "rFNT", 4) != 0) || (header.version != 100))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Font cache data not valid or version not supported");
+    }
+    else if (!validSize)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Font cache data size not valid");
+    }
+    else if (!validAtlas)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Font cache atlas size or format not valid");
+    }
+    else if (!validGlyphs)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Font cache glyphs not valid, rectangles out of atlas");
+    }
+    else
+    {
+        const unsigned char *atlasData = fileData + sizeof(rFontCacheHeader) + glyphsDataSize;
+
+        Image atlas = { 0 };
+        atlas.width = header.atlasWidth;
+        atlas.height = header.atlasHeight;
+        atlas.format = header.atlasFormat;
+        atlas.mipmaps = 1;
+
+        int atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+
+        if (header.compressed)
+        {
+#if defined(SUPPORT_COMPRESSION_API)
+            int decompDataSize = 0;
+            atlas.data = DecompressData(atlasData, header.atlasDataSize, &decompDataSize);
+
+            if ((atlas.data != NULL) && (decompDataSize != atlasDataSize))
+            {
+                RL_FREE(atlas.data);
+                atlas.data = NULL;
+            }
+#else
+            TRACELOG(LOG_WARNING, "FONT: Font cache data compressed, compression not supported");
+#endif
+        }
+        else if (header.atlasDataSize == atlasDataSize) atlas.data = (void *)atlasData;
+
+        if (atlas.data != NULL)
+        {
+            font.texture = LoadTextureFromImage(atlas);
+
+            if (font.texture.id > 0)
+            {
+                font.baseSize = header.baseSize;
+                font.glyphCount = header.glyphCount;
+                font.glyphPadding = header.glyphPadding;
+                font.glyphs = (GlyphInfo *)RL_MALLOC(font.glyphCount*sizeof(GlyphInfo));
+                font.recs = (Rectangle *)RL_MALLOC(font.glyphCount*sizeof(Rectangle));
+
+                for (int i = 0; i < font.glyphCount; i++)
+                {
+                    rFontCacheGlyph glyph = { 0 };
+                    memcpy(&glyph, fileData + sizeof(rFontCacheHeader) + i*sizeof(rFontCacheGlyph), sizeof(rFontCacheGlyph));
+
+                    font.glyphs[i].value = glyph.value;
+                    font.glyphs[i].offsetX = glyph.offsetX;
+                    font.glyphs[i].offsetY = glyph.offsetY;
+                    font.glyphs[i].advanceX = glyph.advanceX;
+                    font.recs[i] = glyph.rec;
+
+                    // Glyph image, required to be used on ImageDrawText()
+                    font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
+                }
+
+                font.lookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
+                TRACELOG(LOG_INFO, "FONT: Font cache loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
+            }
+
+            if (atlas.data != atlasData) RL_FREE(atlas.data);
+        }
+        else TRACELOG(LOG_WARNING, "FONT: Failed to load font cache atlas data");
+    }
+
+    if (font.texture.id == 0) font = GetFontDefault();
+
+    return font;
+}
+#endif
+
+// Load glyphs lookup by codepoint
+// NOTE: Duplicated codepoints keep first glyph and fallback is last '?' glyph, same results than linear search
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    rGlyphLookup *lookup = (rGlyphLookup *)RL_CALLOC(1, sizeof(rGlyphLookup));
+    lookup->glyphs = glyphs;
+    lookup->glyphCount = glyphCount;
+
+    int extendedCount = 0;      // Glyphs out of Basic Multilingual Plane, mapped by hash table
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if (glyphs[i].value == 63) lookup->fallbackIndex = i;
+        if ((glyphs[i].value < 0) || (glyphs[i].value >= 0x10000)) extendedCount++;
+    }
+
+    InitGlyphLookupHash(lookup, extendedCount);
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if (FindGlyphLookup(lookup, glyphs[i].value) < 0) SetGlyphLookup(lookup, glyphs[i].value, i);
+    }
+
+    return lookup;
+}
+
+// Unload glyphs lookup
+static void UnloadGlyphLookup(rGlyphLookup *lookup)
+{
+    if (lookup == NULL) return;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    UnloadGlyphCache(lookup->cache);
+#endif
+    for (int i = 0; i < 256; i++) RL_FREE(lookup->pages[i]);
+    RL_FREE(lookup->hashCodepoints);    // NOTE: Hash indices are stored in same memory block
+    RL_FREE(lookup);
+}
+
+// Init glyphs lookup hash table for extended codepoints (out of Basic Multilingual Plane)
+// NOTE: Hash table load factor is kept under 0.5 for the expected entries
+static void InitGlyphLookupHash(rGlyphLookup *lookup, int entryCount)
+{
+    if (entryCount <= 0) return;
+
+    lookup->hashSize = 16;
+    while (lookup->hashSize < 2*entryCount) lookup->hashSize *= 2;
+
+    lookup->hashCodepoints = (int *)RL_MALLOC(2*lookup->hashSize*sizeof(int));
+    lookup->hashIndices = lookup->hashCodepoints + lookup->hashSize;
+    for (int i = 0; i < lookup->hashSize; i++) lookup->hashIndices[i] = -1;
+}
+
+// Find glyph index for codepoint, -1 if not available
+static int FindGlyphLookup(const rGlyphLookup *lookup, int codepoint)
+{
+    int index = -1;
+
+    if ((codepoint >= 0) && (codepoint < 0x10000))
+    {
+        const int *page = lookup->pages[codepoint >> 8];
+        if (page != NULL) index = page[codepoint & 0xff] - 1;
+    }
+    else if (lookup->hashSize > 0)
+    {
+        unsigned int slot = ((unsigned int)codepoint*2654435761u) & (lookup->hashSize - 1);
+
+        while (lookup->hashIndices[slot] >= 0)
+        {
+            if (lookup->hashCodepoints[slot] == codepoint)
+            {
+                index = lookup->hashIndices[slot];
+                break;
+            }
+
+            slot = (slot + 1) & (lookup->hashSize - 1);
+        }
+    }
+
+    return index;
+}
+
+// Set glyph index for codepoint, -1 to remove it
+// WARNING: Extended codepoints require hash table space [InitGlyphLookupHash()]
+static void SetGlyphLookup(rGlyphLookup *lookup, int codepoint, int index)
+{
+    if ((codepoint >= 0) && (codepoint < 0x10000))
+    {
+        if (lookup->pages[codepoint >> 8] == NULL)
+        {
+            if (index < 0) return;
+            lookup->pages[codepoint >> 8] = (int *)RL_CALLOC(256, sizeof(int));
+        }
+
+        lookup->pages[codepoint >> 8][codepoint & 0xff] = index + 1;
+    }
+    else if (lookup->hashSize > 0)
+    {
+        unsigned int mask = lookup->hashSize - 1;
+        unsigned int slot = ((unsigned int)codepoint*2654435761u) & mask;
+
+        while ((lookup->hashIndices[slot] >= 0) && (lookup->hashCodepoints[slot] != codepoint)) slot = (slot + 1) & mask;
+
+        if (index >= 0)
+        {
+            lookup->hashCodepoints[slot] = codepoint;
+            lookup->hashIndices[slot] = index;
+        }
+        else if (lookup->hashIndices[slot] >= 0)
+        {
+            // Remove entry shifting back following entries of the probe sequence (no tombstones required)
+            lookup->hashIndices[slot] = -1;
+
+            for (unsigned int next = (slot + 1) & mask; lookup->hashIndices[next] >= 0; next = (next + 1) & mask)
+            {
+                unsigned int home = ((unsigned int)lookup->hashCodepoints[next]*2654435761u) & mask;
+
+                if (((next - home) & mask) >= ((next - slot) & mask))
+                {
+                    lookup->hashCodepoints[slot] = lookup->hashCodepoints[next];
+                    lookup->hashIndices[slot] = lookup->hashIndices[next];
+                    lookup->hashIndices[next] = -1;
+                    slot = next;
+                }
+            }
+        }
+    }
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load glyph info and image for a codepoint from font info
+// NOTE: Generated image is GRAYSCALE, an empty image is generated for space character
+static GlyphInfo LoadGlyphFromFontInfo(const stbtt_fontinfo *fontInfo, int fontSize, int codepoint, int type)
+{
+    GlyphInfo glyph = { 0 };
+
+    // Calculate font scale factor
+    float scaleFactor = stbtt_ScaleForPixelHeight(fontInfo, (float)fontSize);
+
+    // Calculate font basic metrics
+    // NOTE: ascent is equivalent to font baseline
+    int ascent, descent, lineGap;
+    stbtt_GetFontVMetrics(fontInfo, &ascent, &descent, &lineGap);
+
+    int chw = 0, chh = 0;   // Character width and height (on generation)
+    int ch = codepoint;     // Character value to get info for
+    glyph.value = ch;
+
+    //  Render a unicode codepoint to a bitmap
+    //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+    //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+    //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+    if (type != FONT_SDF) glyph.image.data = stbtt_GetCodepointBitmap(fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &glyph.offsetX, &glyph.offsetY);
+    else if (ch != 32) glyph.image.data = GenGlyphSDF(fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &glyph.offsetX, &glyph.offsetY);
+    else glyph.image.data = NULL;
+
+    stbtt_GetCodepointHMetrics(fontInfo, ch, &glyph.advanceX, NULL);
+    glyph.advanceX = (int)((float)glyph.advanceX*scaleFactor);
+
+    // Load characters images
+    glyph.image.width = chw;
+    glyph.image.height = chh;
+    glyph.image.mipmaps = 1;
+    glyph.image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+    glyph.offsetY += (int)((float)ascent*scaleFactor);
+
+    // NOTE: We create an empty image for space character, it could be further required for atlas packing
+    if (ch == 32)
+    {
+        Image imSpace = {
+            .data = RL_CALLOC(glyph.advanceX*fontSize, 2),
+            .width = glyph.advanceX,
+            .height = fontSize,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+        };
+
+        UnloadImage(glyph.image);
+        glyph.image = imSpace;
+    }
+
+    if (type == FONT_BITMAP)
+    {
+        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+        // NOTE: For optimum results, bitmap font should be generated at base pixel size
+        for (int p = 0; p < chw*chh; p++)
+        {
+            if (((unsigned char *)glyph.image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)glyph.image.data)[p] = 0;
+            else ((unsigned char *)glyph.image.data)[p] = 255;
+        }
+    }
+
+    // Get bounding box for character (maybe offset to account for chars that dip above or below the line)
+    /*
+    int chX1, chY1, chX2, chY2;
+    stbtt_GetCodepointBitmapBox(fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
+
+    TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
+    TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
+    */
+
+    return glyph;
+}
+
+// Load glyphs range task, glyphs [index*FONT_TASK_GLYPHS, (index + 1)*FONT_TASK_GLYPHS)
+static void LoadGlyphsTask(void *data, int index)
+{
+    GlyphLoadTasks *tasks = (GlyphLoadTasks *)data;
+
+    int start = index*FONT_TASK_GLYPHS;
+    int end = start + FONT_TASK_GLYPHS;
+    if (end > tasks->codepointCount) end = tasks->codepointCount;
+
+    for (int i = start; i < end; i++) tasks->glyphs[i] = LoadGlyphFromFontInfo(tasks->fontInfo, tasks->fontSize, tasks->codepoints[i], tasks->type);
+}
+
+// Generate glyph SDF image (GRAYSCALE), same output layout and values as stbtt_GetCodepointSDF()
+// NOTE: Instead of measuring distance from every pixel to every glyph curve, glyph coverage is rasterized
+// and the nearest edge pixel is found with a linear time euclidean distance transform [Felzenszwalb and Huttenlocher],
+// edge pixels (partially covered or next to the other side) estimate the edge at subpixel precision from coverage
+static unsigned char *GenGlyphSDF(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int padding, unsigned char onEdgeValue, float pixelDistScale, int *width, int *height, int *offsetX, int *offsetY)
+{
+    if (scale == 0) return NULL;
+
+    int glyph = stbtt_FindGlyphIndex(fontInfo, codepoint);
+
+    int ix0, iy0, ix1, iy1;
+    stbtt_GetGlyphBitmapBox(fontInfo, glyph, scale, scale, &ix0, &iy0, &ix1, &iy1);
+
+    // If empty, return NULL
+    if ((ix0 == ix1) || (iy0 == iy1)) return NULL;
+
+    int w = (ix1 - ix0) + 2*padding;
+    int h = (iy1 - iy0) + 2*padding;
+
+    // Rasterize glyph coverage inside padded image
+    unsigned char *coverage = (unsigned char *)RL_CALLOC(w*h, 1);
+    stbtt_MakeGlyphBitmap(fontInfo, coverage + padding*w + padding, ix1 - ix0, iy1 - iy0, w, scale, scale, glyph);
+
+    // Edge pixels are the distance transform seeds: partially covered pixels or
+    // pixels next to a pixel on the other side of the edge (4-connected)
+    float *dist = (float *)RL_MALLOC(w*h*sizeof(float));     // Squared distance to nearest edge pixel
+    int *nearest = (int *)RL_MALLOC(w*h*sizeof(int));        // Nearest edge pixel: column pass y, row pass index
+
+    for (int y = 0, i = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++, i++)
+        {
+            bool inside = (coverage[i] >= 128);
+            bool edge = ((coverage[i] > 0) && (coverage[i] < 255)) ||
+                        ((x > 0) && ((coverage[i - 1] >= 128) != inside)) || ((x < (w - 1)) && ((coverage[i + 1] >= 128) != inside)) ||
+                        ((y > 0) && ((coverage[i - w] >= 128) != inside)) || ((y < (h - 1)) && ((coverage[i + w] >= 128) != inside));
+
+            dist[i] = edge? 0.0f : SDF_DISTANCE_INF;
+        }
+    }
+
+    // Separable 2D transform: columns and then rows
+    int n = (w > h)? w : h;
+    float *f = (float *)RL_MALLOC(n*sizeof(float));
+    float *d = (float *)RL_MALLOC(n*sizeof(float));
+    float *z = (float *)RL_MALLOC((n + 1)*sizeof(float));
+    int *v = (int *)RL_MALLOC(n*sizeof(int));
+    int *k = (int *)RL_MALLOC(n*sizeof(int));
+
+    for (int x = 0; x < w; x++)
+    {
+        for (int y = 0; y < h; y++) f[y] = dist[y*w + x];
+        DistanceTransform1D(f, h, d, k, v, z);
+        for (int y = 0; y < h; y++)
+        {
+            dist[y*w + x] = d[y];
+            nearest[y*w + x] = k[y];
+        }
+    }
+
+    for (int y = 0; y < h; y++)
+    {
+        memcpy(f, dist + y*w, w*sizeof(float));
+        DistanceTransform1D(f, w, dist + y*w, k, v, z);
+        for (int x = 0; x < w; x++) k[x] = nearest[y*w + k[x]]*w + k[x];
+        memcpy(nearest + y*w, k, w*sizeof(int));
+    }
+
+    // Signed distance to glyph edge (positive inside): distance to nearest edge pixel plus
+    // its own distance to the edge, estimated from coverage, mapped to image values
+    unsigned char *data = (unsigned char *)RL_MALLOC(w*h);
+
+    for (int i = 0; i < w*h; i++)
+    {
+        float signedDist = -SDF_DISTANCE_INF;
+
+        if (dist[i] < SDF_DISTANCE_INF)     // No edge pixels for blank glyphs
+        {
+            float edgeDist = (float)coverage[nearest[i]]/255.0f - 0.5f;
+
+            if (dist[i] == 0.0f) signedDist = edgeDist;
+            else if (coverage[i] >= 128) signedDist = sqrtf(dist[i]) + edgeDist;
+            else signedDist = edgeDist - sqrtf(dist[i]);
+        }
+
+        float value = onEdgeValue + pixelDistScale*signedDist;
+        data[i] = (value < 0.0f)? 0 : (value > 255.0f)? 255 : (unsigned char)value;
+    }
+
+    RL_FREE(k);
+    RL_FREE(v);
+    RL_FREE(z);
+    RL_FREE(d);
+    RL_FREE(f);
+    RL_FREE(nearest);
+    RL_FREE(dist);
+    RL_FREE(coverage);
+
+    *width = w;
+    *height = h;
+    *offsetX = ix0 - padding;
+    *offsetY = iy0 - padding;
+
+    return data;
+}
+
+// Squared euclidean distance transform of a sampled function (one dimension), linear time
+// Outputs squared distance (d) and nearest sample index (nearest) for every sample
+// NOTE: Lower envelope of the parabolas rooted at every sample, v: parabolas locations, z: envelope ranges
+static void DistanceTransform1D(const float *f, int n, float *d, int *nearest, int *v, float *z)
+{
+    int k = 0;
+    v[0] = 0;
+    z[0] = -SDF_DISTANCE_INF;
+    z[1] = SDF_DISTANCE_INF;
+
+    for (int q = 1; q < n; q++)
+    {
+        float s = ((f[q] + (float)(q*q)) - (f[v[k]] + (float)(v[k]*v[k])))/(float)(2*q - 2*v[k]);
+
+        while ((k > 0) && (s <= z[k]))
+        {
+            k--;
+            s = ((f[q] + (float)(q*q)) - (f[v[k]] + (float)(v[k]*v[k])))/(float)(2*q - 2*v[k]);
+        }
+
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = SDF_DISTANCE_INF;
+    }
+
+    k = 0;
+
+    for (int q = 0; q < n; q++)
+    {
+        while (z[k + 1] < (float)q) k++;
+        d[q] = (float)((q - v[k])*(q - v[k])) + f[v[k]];
+        nearest[q] = v[k];
+    }
+}
+
+// Load a new atlas page for glyph cache, returns false if page could not be loaded
+static bool LoadGlyphCachePage(GlyphCache *cache)
+{
+    if (cache->pageCount >= FONT_CACHE_MAX_PAGES) return false;
+
+    int pageWidth = cache->columns*cache->cellWidth;
+    int pageHeight = (cache->slotsPerPage/cache->columns)*cache->cellHeight;
+
+    Image page = {
+        .data = RL_CALLOC(pageWidth*pageHeight, 2),
+        .width = pageWidth,
+        .height = pageHeight,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+    };
+
+    Texture2D texture = LoadTextureFromImage(page);
+    UnloadImage(page);
+
+    if (texture.id == 0) return false;
+
+    SetTextureFilter(texture, cache->filter);
+
+    cache->pages[cache->pageCount] = texture;
+    cache->pageCount++;
+
+    TRACELOGD("FONT: Glyph cache atlas page %i loaded (%i glyphs per page)", cache->pageCount, cache->slotsPerPage);
+
+    return true;
+}
+
+// Load glyph into glyph cache slot, replacing previous one
+// NOTE: Glyph image is kept as GRAY_ALPHA, same as fonts loaded with all glyphs [ImageDrawText()]
+static void LoadGlyphCacheSlot(GlyphCache *cache, int codepoint, int slot)
+{
+    GlyphInfo *glyph = &cache->glyphs[slot];
+    int padding = cache->padding;
+
+    UnloadImage(glyph->image);
+    *glyph = LoadGlyphFromFontInfo(&cache->fontInfo, cache->fontSize, codepoint, FONT_DEFAULT);
+
+    // Glyphs should fit in cells (font bounding box), clip them just in case
+    int width = glyph->image.width;
+    int height = glyph->image.height;
+    if (width > (cache->cellWidth - 2*padding)) width = cache->cellWidth - 2*padding;
+    if (height > (cache->cellHeight - 2*padding)) height = cache->cellHeight - 2*padding;
+
+    Image image = {
+        .data = ((width*height) > 0)? RL_MALLOC(width*height*2) : NULL,
+        .width = width,
+        .height = height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+    };
+
+    // Fill cell data, padding is cleared to avoid previous glyph pixels bleeding
+    memset(cache->cellData, 0, cache->cellWidth*cache->cellHeight*2);
+
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char *src = (const unsigned char *)glyph->image.data + y*glyph->image.width;
+        unsigned char *dst = (unsigned char *)image.data + y*width*2;
+
+        for (int x = 0; x < width; x++)
+        {
+            dst[x*2] = 255;
+            dst[x*2 + 1] = src[x];
+        }
+
+        memcpy(cache->cellData + ((y + padding)*cache->cellWidth + padding)*2, dst, width*2);
+    }
+
+    UnloadImage(glyph->image);
+    glyph->image = image;
+
+    int page = slot/cache->slotsPerPage;
+    int cell = slot%cache->slotsPerPage;
+    int cellX = (cell%cache->columns)*cache->cellWidth;
+    int cellY = (cell/cache->columns)*cache->cellHeight;
+
+    cache->recs[slot] = (Rectangle){ (float)(cellX + padding), (float)(cellY + padding), (float)width, (float)height };
+
+    rlUpdateTexture(cache->pages[page].id, cellX, cellY, cache->cellWidth, cache->cellHeight, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, cache->cellData);
+}
+
+// Get glyph index from glyph cache, loading glyph if required
+// NOTE: Glyph is moved to the front of the least recently used list, once all atlas pages are full
+// the least recently used glyph is evicted, fallback glyph (slot 0) is never evicted
+static int GetGlyphCacheIndex(rGlyphLookup *lookup, int codepoint)
+{
+    GlyphCache *cache = lookup->cache;
+    int index = FindGlyphLookup(lookup, codepoint);
+
+    if (index < 0)
+    {
+        index = lookup->fallbackIndex;
+
+        if ((codepoint >= 0) && (stbtt_FindGlyphIndex(&cache->fontInfo, codepoint) > 0))
+        {
+            if (cache->usedSlots == cache->pageCount*cache->slotsPerPage) LoadGlyphCachePage(cache);
+
+            if (cache->usedSlots < cache->pageCount*cache->slotsPerPage) index = cache->usedSlots++;
+            else if (cache->tail > 0)
+            {
+                index = cache->tail;
+
+                // Evict least recently used glyph
+                // NOTE: Its atlas cell could be referenced by vertex data in current render batch
+                cache->tail = cache->prev[index];
+                if (cache->tail >= 0) cache->next[cache->tail] = -1;
+                else cache->head = -1;
+                cache->prev[index] = -1;
+
+                SetGlyphLookup(lookup, cache->glyphs[index].value, -1);
+                rlDrawRenderBatchActive();
+            }
+
+            if (index != lookup->fallbackIndex)
+            {
+                LoadGlyphCacheSlot(cache, codepoint, index);
+                SetGlyphLookup(lookup, codepoint, index);
+            }
+        }
+        else if ((codepoint >= 0) && (codepoint < 0x10000)) SetGlyphLookup(lookup, codepoint, index);   // Codepoint not available in font, keep fallback
+    }
+
+    // Move glyph to the front of least recently used list
+    if ((index != lookup->fallbackIndex) && (index != cache->head))
+    {
+        if (cache->prev[index] >= 0)
+        {
+            // Unlink glyph from current list position
+            cache->next[cache->prev[index]] = cache->next[index];
+            if (cache->next[index] >= 0) cache->prev[cache->next[index]] = cache->prev[index];
+            else cache->tail = cache->prev[index];
+        }
+
+        cache->prev[index] = -1;
+        cache->next[index] = cache->head;
+        if (cache->head >= 0) cache->prev[cache->head] = index;
+        cache->head = index;
+        if (cache->tail < 0) cache->tail = index;
+    }
+
+    return index;
+}
+
+// Unload glyph cache
+// NOTE: Glyphs, recs and first atlas page are unloaded with font [UnloadFont()]
+static void UnloadGlyphCache(GlyphCache *cache)
+{
+    if (cache == NULL) return;
+
+    for (int i = 1; i < cache->pageCount; i++) UnloadTexture(cache->pages[i]);
+
+    RL_FREE(cache->fileData);
+    RL_FREE(cache->prev);
+    RL_FREE(cache->next);
+    RL_FREE(cache->cellData);
+    RL_FREE(cache);
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXT
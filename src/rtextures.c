@@ -77,6 +77,7 @@
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()]
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
+#include <limits.h>             // Required for: INT_MAX [Used in GenImageAtlas()]
 
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
@@ -213,7 +214,13 @@
 #define STBIR_MALLOC(size,c) ((void)(c), RL_MALLOC(size))
 #define STBIR_FREE(ptr,c) ((void)(c), RL_FREE(ptr))
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
-#include "external/stb_image_resize2.h"  // Required for: stbir_resize_uint8_linear() [ImageResize()]
+#include "external/stb_image_resize2.h"  // Required for: stbir_resize_init(), stbir_resize_extended_split() [ImageResize()]
+
+// Image processing vectorization (blending, blur): SSE2 on x86/x64, scalar otherwise
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RTEXTURES_SIMD_SSE2
+    #include <emmintrin.h>                  // Required for: _mm_loadu_si128(), _mm_mullo_epi16(), _mm_div_ps()... [Used in BlendImageRowR8G8B8A8(), BlurImageRows()]
+#endif
 
 #if defined(SUPPORT_FILEFORMAT_SVG)
 	#define NANOSVG_IMPLEMENTATION	// Expands implementation
@@ -234,15 +241,178 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef IMAGE_TASK_MIN_PIXELS
+    #define IMAGE_TASK_MIN_PIXELS   65536  // Minimum pixels processed per image processing task (see SetTaskDispatchCallback())
+#endif
+
+#ifndef ATLAS_PACK_SEARCH_STEPS
+    #define ATLAS_PACK_SEARCH_STEPS   32   // Atlas widths tried searching minimum area atlas: GenImageAtlas()
+#endif
+
+#ifndef IMAGE_ENCODE_BAND_PIXELS
+    #define IMAGE_ENCODE_BAND_PIXELS  262144  // Minimum pixels encoded per image band task (PNG/QOI parallel export)
+#endif
+
+#define DEFLATE_WINDOW_SIZE       32768    // Deflate matches window size (maximum distance)
+#define DEFLATE_HASH_SIZE         32768    // Deflate matches hash table size (power of two)
+#define DEFLATE_MIN_MATCH             3    // Deflate minimum match length
+#define DEFLATE_MAX_MATCH           258    // Deflate maximum match length
+#define DEFLATE_DEFAULT_LEVEL         6    // Deflate default compression level
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Atlas skyline node, segment of packed area top edge
+typedef struct AtlasSkylineNode {
+    int x;                      // Segment start position x
+    int y;                      // Segment height (packed area top edge)
+    int width;                  // Segment width
+} AtlasSkylineNode;
+
+// Atlas skyline, packed area top edge as segments sorted by x, covering atlas width
+struct rAtlasSkyline {
+    AtlasSkylineNode *nodes;    // Skyline segments
+    int nodeCount;              // Skyline segments count
+};
+
+// Atlas packing rectangle, padding included
+typedef struct AtlasPackRec {
+    int width;                  // Rectangle width
+    int height;                 // Rectangle height
+    int index;                  // Image index
+} AtlasPackRec;
+
+// Color hash table entry, used for palette extraction
+typedef struct ColorHashEntry {
+    unsigned int color;         // Color packed as 32bit (RGBA)
+    int count;                  // Pixels with this color (0: empty entry)
+    int index;                  // Palette index
+} ColorHashEntry;
+
+// Color hash table, open addressing with linear probing
+typedef struct ColorHashTable {
+    ColorHashEntry *entries;    // Entries array (capacity is power of two)
+    int capacity;               // Entries capacity
+    int count;                  // Entries used
+} ColorHashTable;
+
+// Image rows processing task, rows are split in tiles run as tasks
+// NOTE: Tasks run in parallel if a tasks dispatcher is set, results must not depend on tiles
+typedef struct ImageRowsTask {
+    void (*process)(void *data, int first, int last);   // Rows range processing function: [first, last)
+    void *data;                 // Processing function data
+    int rows;                   // Rows to process
+    int tileRows;               // Rows processed per tile
+} ImageRowsTask;
+
+// Direct pixel format conversion task data
+typedef struct ConvertDirectTask {
+    const void *data;           // Source pixel data
+    unsigned char *newData;     // Destination pixel data
+    int format;                 // Source pixel format
+    int newFormat;              // Destination pixel format
+    float grayR[256];           // Lookup table: red contribution to gray
+    float grayG[256];           // Lookup table: green contribution to gray
+    float grayB[256];           // Lookup table: blue contribution to gray
+    unsigned char to4bit[256];  // Lookup table: 8bit to 4bit channel
+    unsigned char to5bit[256];  // Lookup table: 8bit to 5bit channel
+    unsigned char to6bit[256];  // Lookup table: 8bit to 6bit channel
+    unsigned char from4bit[16]; // Lookup table: 4bit to 8bit channel
+    unsigned char from5bit[32]; // Lookup table: 5bit to 8bit channel
+    unsigned char from6bit[64]; // Lookup table: 6bit to 8bit channel
+} ConvertDirectTask;
+
+// Image filtering task data (blur, convolution)
+typedef struct ImageFilterTask {
+    Color *pixels;              // Image pixels
+    Vector4 *output;            // Filter output values
+    int width;                  // Image width
+    int height;                 // Image height
+    int size;                   // Blur size or kernel width
+    const float *kernel;        // Convolution kernel
+    const float *scales;        // Blur window pixels count reciprocals
+} ImageFilterTask;
+
+// Image colors adjustment task data
+typedef struct ImageColorTask {
+    Color *pixels;              // Image pixels
+    int width;                  // Image width
+    Color color;                // Tint color or color to replace
+    Color replace;              // Replacement color
+    float contrast;             // Contrast factor
+    int brightness;             // Brightness offset
+} ImageColorTask;
+
+// Deflate fixed Huffman codes and symbols lookup tables
+// NOTE: Codes are stored bit-reversed, deflate streams are written LSB first
+typedef struct DeflateCodes {
+    unsigned short literalCodes[288];       // Literal/length symbols codes
+    unsigned char literalBits[288];         // Literal/length symbols codes bits
+    unsigned char distanceCodes[30];        // Distance symbols codes (5 bits)
+    unsigned char lengthSymbols[259];       // Match length to length symbol
+    unsigned char distanceSymbols[512];     // Match distance to distance symbol: [distance - 1] up to 256, [256 + ((distance - 1) >> 7)] after
+} DeflateCodes;
+
+// Deflate output bits stream
+typedef struct DeflateStream {
+    unsigned char *data;        // Output data
+    int size;                   // Output data size in bytes
+    unsigned int bits;          // Pending bits buffer
+    int bitCount;               // Pending bits count
+} DeflateStream;
+
+// PNG encoding task data, rows filtered and deflated in bands
+typedef struct PNGEncodeTask {
+    const unsigned char *pixels; // Image pixels
+    int width;                  // Image width
+    int height;                 // Image height
+    int channels;               // Image channels (1..4)
+    int level;                  // Compression level [0..9]
+    unsigned char *filtered;    // Filtered rows data (filter type byte + filtered row)
+    int rowSize;                // Filtered row size in bytes
+    int bandRows;               // Rows per band
+    int bandCount;              // Bands count
+    unsigned char **chunks;     // Bands IDAT chunks
+    int *chunkSizes;            // Bands IDAT chunks size in bytes
+    unsigned int *adlers;       // Bands filtered data Adler-32 checksums
+    DeflateCodes codes;         // Deflate codes
+} PNGEncodeTask;
+
+// QOI encoding band, band encoder starts with decoder state at band first pixel
+typedef struct QOIEncodeBand {
+    Color index[64];            // Colors index: last colors seen in band, then colors index at band start
+    bool used[64];              // Colors index entries seen in band
+    unsigned char *data;        // Band encoded data
+    int size;                   // Band encoded data size in bytes
+} QOIEncodeBand;
+
+// QOI encoding task data, pixels encoded in bands
+typedef struct QOIEncodeTask {
+    const unsigned char *pixels; // Image pixels
+    int channels;               // Image channels (3 or 4)
+    int pixelCount;             // Image pixels count
+    int bandPixels;             // Pixels per band
+    QOIEncodeBand *bands;       // Bands
+} QOIEncodeTask;
+
+// Colors box, used for median cut quantization
+typedef struct ColorBox {
+    int first;                  // First color entry
+    int count;                  // Number of color entries
+    int channel;                // Channel with widest range (0: r, 1: g, 2: b, 3: a)
+    int range;                  // Widest channel range
+} ColorBox;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// Deflate length and distance symbols base values and extra bits
+static const unsigned short deflateLengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const unsigned char deflateLengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const unsigned short deflateDistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const unsigned char deflateDistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -255,6 +425,46 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void *ConvertImageDataDirect(const void *data, int pixelCount, int format, int newFormat);  // Convert pixel data without float normalization (8-bit formats)
+static void ConvertImageDataDirectRows(void *data, int first, int last);                // Convert pixels range, direct conversion task
+static void ProcessImageRows(void (*process)(void *data, int first, int last), void *data, int rows, int rowPixels);  // Process image rows, split in tasks
+static void ProcessImageRowsTile(void *data, int index);                                // Process image rows tile, task callback
+static int ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int layout);  // Resize 8bit per channel pixel data
+static void ResizeImageDataSplit(void *data, int index);                                // Resize pixel data split, task callback
+static void BlurImageRows(void *data, int first, int last);                             // Box blur image rows (horizontal), in-place
+static void BlurImageColumns(void *data, int first, int last);                          // Box blur image columns (vertical), in-place
+static void BlurImagePremultiply(void *data, int first, int last);                      // Alpha premultiply image rows
+static void BlurImageUnpremultiply(void *data, int first, int last);                    // Reverse alpha premultiply on image rows
+static void ConvolveImageRows(void *data, int first, int last);                         // Apply convolution kernel to image rows
+static void TintImageRows(void *data, int first, int last);                             // Apply color tint to image rows
+static void InvertImageRows(void *data, int first, int last);                           // Invert colors of image rows
+static void ContrastImageRows(void *data, int first, int last);                         // Apply contrast to image rows
+static void BrightnessImageRows(void *data, int first, int last);                       // Apply brightness to image rows
+static void ReplaceImageRows(void *data, int first, int last);                          // Replace color in image rows, exact RGBA match
+static ColorHashEntry *GetColorHashEntry(ColorHashTable *table, Color color);   // Get color hash table entry, added if not found
+static ColorBox GetColorBox(const ColorHashEntry *entries, int first, int count); // Get colors box widest channel range
+static void BlendImageRowR8G8B8A8(unsigned char *dst, const unsigned char *src, int count, Color tint);  // Blend RGBA8 pixels row, same result as ColorAlphaBlend()
+static void BlitImageScaled(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);  // Draw image scaled, sampling source directly (bilinear)
+static rAtlasSkyline *LoadAtlasSkyline(int width);                                      // Load atlas skyline for atlas width
+static void UnloadAtlasSkyline(rAtlasSkyline *skyline);                                 // Unload atlas skyline
+static void ResetAtlasSkyline(rAtlasSkyline *skyline, int width);                       // Reset atlas skyline to empty atlas
+static bool FindAtlasSkylinePosition(const rAtlasSkyline *skyline, int atlasWidth, int atlasHeight, int width, int height, int *index, int *y);  // Find position for a rectangle in atlas skyline
+static void AddAtlasSkylineLevel(rAtlasSkyline *skyline, int index, int y, int width, int height);  // Add rectangle level to atlas skyline
+static int PackAtlasSkyline(rAtlasSkyline *skyline, int atlasWidth, int atlasHeight, const AtlasPackRec *recs, int count, int *positions);  // Pack rectangles into atlas skyline
+static int CompareAtlasPackRecs(const void *a, const void *b);                          // Compare atlas packing rectangles (qsort() callback)
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+static unsigned char *EncodeImagePNG(const unsigned char *pixels, int width, int height, int channels, int level, int *dataSize);  // Encode PNG file data, row bands filtered and deflated in parallel
+static unsigned char *WritePNGChunk(unsigned char *output, const char *type, int size);  // Write PNG chunk length, type and CRC, returns next chunk position
+static void FilterPNGRows(void *data, int first, int last);                             // Apply PNG filters to image rows, best filter per row
+static void DeflatePNGBand(void *data, int index);                                      // Deflate PNG filtered rows band into an IDAT chunk, task callback
+static void InitDeflateCodes(DeflateCodes *codes);                                      // Init deflate fixed Huffman codes
+static int DeflateData(const unsigned char *data, int start, int end, int level, bool last, const DeflateCodes *codes, unsigned char *output);  // Deflate data range as raw deflate blocks
+#endif
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_QOI)
+static unsigned char *EncodeImageQOI(const unsigned char *pixels, int width, int height, int channels, int *dataSize);  // Encode QOI file data, pixel bands encoded in parallel
+static void IndexQOIBand(void *data, int index);                                        // Get QOI band last seen colors per index entry, task callback
+static void EncodeQOIBand(void *data, int index);                                       // Encode QOI pixels band, task callback
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -663,6 +873,14 @@ void UnloadImage(Image image)
 // Export image data to file
 // NOTE: File format depends on fileName extension
 bool ExportImage(Image image, const char *fileName)
+{
+    return ExportImageEx(image, fileName, -1);
+}
+
+// Export image data to file with compression level
+// NOTE: Compression level only applies to PNG: 0 (no compression) to 9 (best compression), -1 for default,
+// PNG and QOI row bands are encoded in parallel if a tasks dispatcher is set (see SetTaskDispatchCallback())
+bool ExportImageEx(Image image, const char *fileName, int compressionLevel)
 {
     int result = 0;
 
@@ -688,7 +906,12 @@ bool ExportImage(Image image, const char *fileName)
     if (IsFileExtension(fileName, ".png"))
     {
         int dataSize = 0;
-        unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
+        unsigned char *fileData = NULL;
+
+        // NOTE: stb_image_write encoder kept for default serial export
+        if ((compressionLevel < 0) && !IsTaskDispatchReady()) fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
+        else fileData = EncodeImagePNG(imgData, image.width, image.height, channels, compressionLevel, &dataSize);
+
         result = SaveFileData(fileName, fileData, dataSize);
         RL_FREE(fileData);
     }
@@ -721,7 +944,14 @@ bool ExportImage(Image image, const char *fileName)
             desc.channels = channels;
             desc.colorspace = QOI_SRGB;
 
-            result = qoi_write(fileName, imgData, &desc);
+            if (IsTaskDispatchReady())
+            {
+                int dataSize = 0;
+                unsigned char *fileData = EncodeImageQOI(imgData, image.width, image.height, channels, &dataSize);
+                result = SaveFileData(fileName, fileData, dataSize);
+                RL_FREE(fileData);
+            }
+            else result = qoi_write(fileName, imgData, &desc);
         }
     }
 #endif
@@ -749,6 +979,13 @@ bool ExportImage(Image image, const char *fileName)
 
 // Export image to memory buffer
 unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataSize)
+{
+    return ExportImageToMemoryEx(image, fileType, -1, dataSize);
+}
+
+// Export image to memory buffer with compression level
+// NOTE: Compression level only applies to PNG: 0 (no compression) to 9 (best compression), -1 for default
+unsigned char *ExportImageToMemoryEx(Image image, const char *fileType, int compressionLevel, int *dataSize)
 {
     unsigned char *fileData = NULL;
     *dataSize = 0;
@@ -766,7 +1003,18 @@ unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataS
 #if defined(SUPPORT_FILEFORMAT_PNG)
     if ((strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0))
     {
-        fileData = stbi_write_png_to_mem((const unsigned char *)image.data, image.width*channels, image.width, image.height, channels, dataSize);
+        if ((compressionLevel < 0) && !IsTaskDispatchReady()) fileData = stbi_write_png_to_mem((const unsigned char *)image.data, image.width*channels, image.width, image.height, channels, dataSize);
+        else fileData = EncodeImagePNG((const unsigned char *)image.data, image.width, image.height, channels, compressionLevel, dataSize);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    if ((strcmp(fileType, ".qoi") == 0) || (strcmp(fileType, ".QOI") == 0))
+    {
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+        {
+            fileData = EncodeImageQOI((const unsigned char *)image.data, image.width, image.height, channels, dataSize);
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Image pixel format must be R8G8B8 or R8G8B8A8");
     }
 #endif
 
@@ -1159,6 +1407,204 @@ Image GenImageText(int width, int height, const char *text)
 }
 #endif      // SUPPORT_IMAGE_GENERATION
 
+//------------------------------------------------------------------------------------
+// Image atlas packing functions
+//------------------------------------------------------------------------------------
+// Generate image atlas packing images, images rectangles in atlas are returned in recs
+// NOTE: Images are sorted by size and packed with a skyline packer (bottom-left, minimum waste),
+// atlas width is searched to get the minimum area atlas (not power-of-two), atlas pixel format
+// is first packable (not empty) image format, recs memory must be MemFree()
+Image GenImageAtlas(const Image *images, int imageCount, int padding, Rectangle **recs)
+{
+    Image atlas = { 0 };
+
+    if (recs != NULL) *recs = NULL;
+
+    if ((images == NULL) || (imageCount <= 0) || (recs == NULL))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Atlas images not valid, returning empty atlas");
+        return atlas;
+    }
+
+    // Get atlas format from first packable image, empty images are skipped
+    int format = -1;
+    for (int i = 0; i < imageCount; i++)
+    {
+        if ((images[i].data != NULL) && (images[i].width > 0) && (images[i].height > 0))
+        {
+            format = images[i].format;
+            break;
+        }
+    }
+
+    if (format == -1)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Atlas images are empty, returning empty atlas");
+        return atlas;
+    }
+
+    if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Atlas generation not supported for compressed formats");
+        return atlas;
+    }
+
+    if (padding < 0) padding = 0;
+
+    // Get rectangles to pack (padding included), empty images are not packed
+    AtlasPackRec *packRecs = (AtlasPackRec *)RL_MALLOC(imageCount*sizeof(AtlasPackRec));
+    int packCount = 0;
+    int maxWidth = 1;
+    float totalArea = 0.0f;
+
+    for (int i = 0; i < imageCount; i++)
+    {
+        if ((images[i].data == NULL) || (images[i].width <= 0) || (images[i].height <= 0)) continue;
+
+        packRecs[packCount].width = images[i].width + 2*padding;
+        packRecs[packCount].height = images[i].height + 2*padding;
+        packRecs[packCount].index = i;
+
+        if (packRecs[packCount].width > maxWidth) maxWidth = packRecs[packCount].width;
+        totalArea += (float)packRecs[packCount].width*(float)packRecs[packCount].height;
+        packCount++;
+    }
+
+    // Higher rectangles first, packing skyline stays flatter
+    qsort(packRecs, packCount, sizeof(AtlasPackRec), CompareAtlasPackRecs);
+
+    // Search atlas width for minimum area, around the square side fitting total area
+    int side = (int)ceilf(sqrtf(totalArea));
+    int firstWidth = (side/2 > maxWidth)? side/2 : maxWidth;
+    int lastWidth = (side*2 > maxWidth)? side*2 : maxWidth;
+    int step = (lastWidth - firstWidth)/ATLAS_PACK_SEARCH_STEPS;
+    if (step < 1) step = 1;
+
+    rAtlasSkyline *skyline = LoadAtlasSkyline(lastWidth);
+    int *positions = (int *)RL_MALLOC((packCount + 1)*2*sizeof(int));
+
+    int bestWidth = maxWidth;
+    int bestHeight = 0;
+
+    for (int width = firstWidth; width <= lastWidth; width += step)
+    {
+        int height = PackAtlasSkyline(skyline, width, INT_MAX, packRecs, packCount, NULL);
+        if (height < 1) height = 1;
+
+        float area = (float)width*height;
+        float bestArea = (float)bestWidth*bestHeight;
+
+        // Equal area atlases, squarer one preferred
+        if ((bestHeight == 0) || (area < bestArea) || ((area == bestArea) && (abs(width - height) < abs(bestWidth - bestHeight))))
+        {
+            bestWidth = width;
+            bestHeight = height;
+        }
+    }
+
+    PackAtlasSkyline(skyline, bestWidth, INT_MAX, packRecs, packCount, positions);
+    UnloadAtlasSkyline(skyline);
+
+    atlas.width = bestWidth;
+    atlas.height = bestHeight;
+    atlas.format = format;
+    atlas.mipmaps = 1;
+    atlas.data = RL_CALLOC(GetPixelDataSize(atlas.width, atlas.height, atlas.format), 1);
+
+    *recs = (Rectangle *)RL_CALLOC(imageCount, sizeof(Rectangle));
+
+    // Copy images pixel data into atlas, converted to atlas format if required
+    int bytesPerPixel = GetPixelDataSize(1, 1, format);
+
+    for (int k = 0; k < packCount; k++)
+    {
+        int i = packRecs[k].index;
+        int x = positions[2*k] + padding;
+        int y = positions[2*k + 1] + padding;
+
+        Image image = images[i];
+        if (image.format != format)
+        {
+            image = ImageCopy(images[i]);
+            ImageFormat(&image, format);
+        }
+
+        for (int row = 0; row < image.height; row++)
+        {
+            memcpy((unsigned char *)atlas.data + ((y + row)*atlas.width + x)*bytesPerPixel,
+                   (unsigned char *)image.data + row*image.width*bytesPerPixel, image.width*bytesPerPixel);
+        }
+
+        if (image.data != images[i].data) UnloadImage(image);
+
+        (*recs)[i] = (Rectangle){ (float)x, (float)y, (float)images[i].width, (float)images[i].height };
+    }
+
+    RL_FREE(positions);
+    RL_FREE(packRecs);
+
+    return atlas;
+}
+
+// Load atlas rectangles packer (skyline), rectangles can be inserted incrementally
+AtlasPacker LoadAtlasPacker(int width, int height, int padding)
+{
+    AtlasPacker packer = { 0 };
+
+    if ((width > 0) && (height > 0))
+    {
+        packer.width = width;
+        packer.height = height;
+        packer.padding = (padding > 0)? padding : 0;
+        packer.skyline = LoadAtlasSkyline(width);
+        ResetAtlasSkyline(packer.skyline, width);
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Atlas packer size not valid");
+
+    return packer;
+}
+
+// Unload atlas rectangles packer
+void UnloadAtlasPacker(AtlasPacker packer)
+{
+    UnloadAtlasSkyline(packer.skyline);
+}
+
+// Insert rectangle into atlas packer, returns false if no space left
+// NOTE: Returned rec is the rectangle position in atlas, padding excluded
+bool AtlasPackerInsert(AtlasPacker *packer, int width, int height, Rectangle *rec)
+{
+    bool inserted = false;
+
+    if ((packer == NULL) || (packer->skyline == NULL) || (width < 0) || (height < 0)) return false;
+
+    int packWidth = width + 2*packer->padding;
+    int packHeight = height + 2*packer->padding;
+
+    if ((packWidth == 0) || (packHeight == 0))
+    {
+        // Empty rectangle, nothing to pack
+        if (rec != NULL) *rec = (Rectangle){ 0.0f, 0.0f, (float)width, (float)height };
+        inserted = true;
+    }
+    else
+    {
+        int index = 0;
+        int y = 0;
+
+        if (FindAtlasSkylinePosition(packer->skyline, packer->width, packer->height, packWidth, packHeight, &index, &y))
+        {
+            int x = packer->skyline->nodes[index].x;
+            AddAtlasSkylineLevel(packer->skyline, index, y, packWidth, packHeight);
+
+            if (rec != NULL) *rec = (Rectangle){ (float)(x + packer->padding), (float)(y + packer->padding), (float)width, (float)height };
+            inserted = true;
+        }
+    }
+
+    return inserted;
+}
+
 //------------------------------------------------------------------------------------
 // Image manipulation functions
 //------------------------------------------------------------------------------------
@@ -1282,189 +1728,201 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+            // Try direct conversion kernels first, float normalized conversion used as fallback
+            void *data = ConvertImageDataDirect(image->data, image->width*image->height, image->format, newFormat);
 
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
-
-            switch (image->format)
+            if (data != NULL)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+                RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = data;
+                image->format = newFormat;
+            }
+            else
+            {
+                Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
+                RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = NULL;
+                image->format = newFormat;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                switch (image->format)
                 {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
+                    case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+                        }
+
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                    {
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
+                        for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*63.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+                        }
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                    {
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*31.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
+                            a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
                     {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*15.0f));
+                            g = (unsigned char)(round(pixels[i].y*15.0f));
+                            b = (unsigned char)(round(pixels[i].z*15.0f));
+                            a = (unsigned char)(round(pixels[i].w*15.0f));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                        }
+
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                            ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32:
+                    {
+                        // WARNING: Image is converted to GRAYSCALE equivalent 32bit
 
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
                     {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
                     {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                            ((float *)image->data)[i + 3] = pixels[k].w;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16:
                     {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 16bit
+                        // WARNING: Image is converted to GRAYSCALE equivalent 16bit
 
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
                     {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                            ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                            ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
                     {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
-            }
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                            ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                            ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                            ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
+                        }
+                    } break;
+                    default: break;
+                }
 
-            RL_FREE(pixels);
-            pixels = NULL;
+                RL_FREE(pixels);
+                pixels = NULL;
+            }
 
             // In case original image had mipmaps, generate mipmaps for formatted image
             // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
@@ -1622,10 +2080,10 @@ void ImageResize(Image *image, int newWidth, int newHeight)
 
         switch (image->format)
         {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 1); break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 2); break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 3); break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 4); break;
             default: break;
         }
 
@@ -1641,7 +2099,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        ResizeImageData((unsigned char *)pixels, image->width, image->height, (unsigned char *)output, newWidth, newHeight, 4);
 
         int format = image->format;
 
@@ -1930,151 +2388,48 @@ void ImageAlphaPremultiply(Image *image)
     ImageFormat(image, format);
 }
 
-// Apply box blur
-void ImageBlurGaussian(Image *image, int blurSize) {
+// Apply gaussian blur, approximated with box blur iterations
+// NOTE: Box blur is separable and computed with sliding window sums,
+// cost per pixel does not depend on blurSize
+void ImageBlurGaussian(Image *image, int blurSize)
+{
     // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    ImageAlphaPremultiply(image);
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (blurSize < 1)) return;
 
     Color *pixels = LoadImageColors(*image);
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-
-    for (int i = 0; i < (image->height)*(image->width); i++) {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
-    }
-
-    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
-    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++) {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize+1;
-
-            for (int i = 0; i < blurSize+1; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
-
-            pixelsCopy2[row*image->width].x = avgR/convolutionSize;
-            pixelsCopy2[row*image->width].y = avgG/convolutionSize;
-            pixelsCopy2[row*image->width].z = avgB/convolutionSize;
-            pixelsCopy2[row*image->width].w = avgAlpha/convolutionSize;
-
-            for (int x = 1; x < image->width; x++)
-            {
-                if (x-blurSize >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize].w;
-                    convolutionSize--;
-                }
-
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-                }
-
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize+1;
+    // Window never needs to be bigger than image
+    int maxSize = ((image->width > image->height)? image->width : image->height) - 1;
+    if (blurSize > maxSize) blurSize = maxSize;
 
-            for (int i = 0; i < blurSize+1; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
+    // Reciprocals of all possible window pixels count, window averages computed as multiplications
+    float *scales = (float *)RL_MALLOC((blurSize*2 + 2)*sizeof(float));
+    scales[0] = 0.0f;
+    for (int i = 1; i < (blurSize*2 + 2); i++) scales[i] = 1.0f/(float)i;
 
-            pixelsCopy1[col].x = (unsigned char) (avgR/convolutionSize);
-            pixelsCopy1[col].y = (unsigned char) (avgG/convolutionSize);
-            pixelsCopy1[col].z = (unsigned char) (avgB/convolutionSize);
-            pixelsCopy1[col].w = (unsigned char) (avgAlpha/convolutionSize);
+    ImageFilterTask task = { 0 };
+    task.pixels = pixels;
+    task.width = image->width;
+    task.height = image->height;
+    task.size = blurSize;
+    task.scales = scales;
 
-            for (int y = 1; y < image->height; y++)
-            {
-                if (y-blurSize >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
+    // Alpha premultiply to avoid transparent pixels colors bleeding
+    ProcessImageRows(BlurImagePremultiply, &task, image->height, image->width);
 
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
+    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
+    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
+    {
+        ProcessImageRows(BlurImageRows, &task, image->height, image->width);       // Horizontal motion blur
+        ProcessImageRows(BlurImageColumns, &task, image->width, image->height);    // Vertical motion blur
     }
 
-
     // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
-    {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
-        {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
-        }
-    }
+    ProcessImageRows(BlurImageUnpremultiply, &task, image->height, image->width);
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
+    RL_FREE(scales);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -2097,111 +2452,16 @@ void ImageKernelConvolution(Image *image, float* kernel, int kernelSize){
     Color *pixels = LoadImageColors(*image);
 
     Vector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *temp = RL_MALLOC(kernelSize*sizeof(Vector4));
 
+    ImageFilterTask task = { 0 };
+    task.pixels = pixels;
+    task.output = imageCopy2;
+    task.width = image->width;
+    task.height = image->height;
+    task.size = kernelWidth;
+    task.kernel = kernel;
 
-    for(int i = 0; i < kernelSize; i++){
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
-
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
-
-
-    int startRange, endRange;
-    if(kernelWidth % 2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
-    } else 
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2+1;
-    }
-    for(int x = 0; x < image->height; x++) 
-    {
-        for(int y = 0; y < image->width; y++) 
-        {
-
-            for(int xk = startRange; xk < endRange; xk++)
-            {
-                for(int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    size_t imgindex = image->width * (x+xk) + (y+yk);
-                    if(imgindex < 0 || imgindex >= image->width * image->height){
-                        temp[kernelWidth * xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth * xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth * xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth * xkabs + ykabs].w = 0.0f;
-                    } else {
-                        temp[kernelWidth * xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f * kernel[kernelWidth * xkabs + ykabs];
-                        temp[kernelWidth * xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f * kernel[kernelWidth * xkabs + ykabs];
-                        temp[kernelWidth * xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f * kernel[kernelWidth * xkabs + ykabs];
-                        temp[kernelWidth * xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f * kernel[kernelWidth * xkabs + ykabs];
-                    }
-                }
-            }
-
-            for(int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
-
-            if(rRes < 0.0f)
-            {
-                rRes = 0.0f;
-            }
-            if(gRes < 0.0f)
-            {
-                gRes = 0.0f;
-            }
-            if(bRes < 0.0f)
-            {
-                bRes = 0.0f;
-            }
-
-            if(rRes > 1.0f)
-            {
-                rRes = 1.0f;
-            }
-            if(gRes > 1.0f)
-            {
-                gRes = 1.0f;
-            }
-             if(bRes > 1.0f)
-            {
-                bRes = 1.0f;
-            }
-
-            imageCopy2[image->width * (x) + (y)].x = rRes;
-            imageCopy2[image->width * (x) + (y)].y = gRes;
-            imageCopy2[image->width * (x) + (y)].z = bRes;
-            imageCopy2[image->width * (x) + (y)].w = aRes;
-
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
-
-            for(int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
-        }
-    }
+    ProcessImageRows(ConvolveImageRows, &task, image->height, image->width*kernelSize);
 
     for (int i = 0; i < (image->width) * (image->height); i++) 
     {
@@ -2210,14 +2470,11 @@ void ImageKernelConvolution(Image *image, float* kernel, int kernelSize){
         pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
         pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
         pixels[i].a = (unsigned char)((alpha)*255.0f);
-        // printf("pixels[%d] = %d", i, pixels[i].r); 
     }
 
-
     int format = image->format;
     RL_FREE(image->data);
     RL_FREE(imageCopy2);
-    RL_FREE(temp);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -2606,27 +2863,12 @@ void ImageColorTint(Image *image, Color color)
 
     Color *pixels = LoadImageColors(*image);
 
-    float cR = (float)color.r/255;
-    float cG = (float)color.g/255;
-    float cB = (float)color.b/255;
-    float cA = (float)color.a/255;
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int index = y*image->width + x;
-            unsigned char r = (unsigned char)(((float)pixels[index].r/255*cR)*255.0f);
-            unsigned char g = (unsigned char)(((float)pixels[index].g/255*cG)*255.0f);
-            unsigned char b = (unsigned char)(((float)pixels[index].b/255*cB)*255.0f);
-            unsigned char a = (unsigned char)(((float)pixels[index].a/255*cA)*255.0f);
+    ImageColorTask task = { 0 };
+    task.pixels = pixels;
+    task.width = image->width;
+    task.color = color;
 
-            pixels[index].r = r;
-            pixels[index].g = g;
-            pixels[index].b = b;
-            pixels[index].a = a;
-        }
-    }
+    ProcessImageRows(TintImageRows, &task, image->height, image->width);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2645,15 +2887,11 @@ void ImageColorInvert(Image *image)
 
     Color *pixels = LoadImageColors(*image);
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            pixels[y*image->width + x].r = 255 - pixels[y*image->width + x].r;
-            pixels[y*image->width + x].g = 255 - pixels[y*image->width + x].g;
-            pixels[y*image->width + x].b = 255 - pixels[y*image->width + x].b;
-        }
-    }
+    ImageColorTask task = { 0 };
+    task.pixels = pixels;
+    task.width = image->width;
+
+    ProcessImageRows(InvertImageRows, &task, image->height, image->width);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2685,39 +2923,12 @@ void ImageColorContrast(Image *image, float contrast)
 
     Color *pixels = LoadImageColors(*image);
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            float pR = (float)pixels[y*image->width + x].r/255.0f;
-            pR -= 0.5f;
-            pR *= contrast;
-            pR += 0.5f;
-            pR *= 255;
-            if (pR < 0) pR = 0;
-            if (pR > 255) pR = 255;
-
-            float pG = (float)pixels[y*image->width + x].g/255.0f;
-            pG -= 0.5f;
-            pG *= contrast;
-            pG += 0.5f;
-            pG *= 255;
-            if (pG < 0) pG = 0;
-            if (pG > 255) pG = 255;
-
-            float pB = (float)pixels[y*image->width + x].b/255.0f;
-            pB -= 0.5f;
-            pB *= contrast;
-            pB += 0.5f;
-            pB *= 255;
-            if (pB < 0) pB = 0;
-            if (pB > 255) pB = 255;
-
-            pixels[y*image->width + x].r = (unsigned char)pR;
-            pixels[y*image->width + x].g = (unsigned char)pG;
-            pixels[y*image->width + x].b = (unsigned char)pB;
-        }
-    }
+    ImageColorTask task = { 0 };
+    task.pixels = pixels;
+    task.width = image->width;
+    task.contrast = contrast;
+
+    ProcessImageRows(ContrastImageRows, &task, image->height, image->width);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2740,28 +2951,12 @@ void ImageColorBrightness(Image *image, int brightness)
 
     Color *pixels = LoadImageColors(*image);
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int cR = pixels[y*image->width + x].r + brightness;
-            int cG = pixels[y*image->width + x].g + brightness;
-            int cB = pixels[y*image->width + x].b + brightness;
-
-            if (cR < 0) cR = 1;
-            if (cR > 255) cR = 255;
-
-            if (cG < 0) cG = 1;
-            if (cG > 255) cG = 255;
+    ImageColorTask task = { 0 };
+    task.pixels = pixels;
+    task.width = image->width;
+    task.brightness = brightness;
 
-            if (cB < 0) cB = 1;
-            if (cB > 255) cB = 255;
-
-            pixels[y*image->width + x].r = (unsigned char)cR;
-            pixels[y*image->width + x].g = (unsigned char)cG;
-            pixels[y*image->width + x].b = (unsigned char)cB;
-        }
-    }
+    ProcessImageRows(BrightnessImageRows, &task, image->height, image->width);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2780,22 +2975,13 @@ void ImageColorReplace(Image *image, Color color, Color replace)
 
     Color *pixels = LoadImageColors(*image);
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            if ((pixels[y*image->width + x].r == color.r) &&
-                (pixels[y*image->width + x].g == color.g) &&
-                (pixels[y*image->width + x].b == color.b) &&
-                (pixels[y*image->width + x].a == color.a))
-            {
-                pixels[y*image->width + x].r = replace.r;
-                pixels[y*image->width + x].g = replace.g;
-                pixels[y*image->width + x].b = replace.b;
-                pixels[y*image->width + x].a = replace.a;
-            }
-        }
-    }
+    ImageColorTask task = { 0 };
+    task.pixels = pixels;
+    task.width = image->width;
+    task.color = color;
+    task.replace = replace;
+
+    ProcessImageRows(ReplaceImageRows, &task, image->height, image->width);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2956,11 +3142,10 @@ Color *LoadImageColors(Image image)
 }
 
 // Load colors palette from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImagePalette()
+// NOTE 1: Memory allocated should be freed using UnloadImagePalette()
+// NOTE 2: Colors are stored in order of appearance, transparent pixels are skipped
 Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
-
     int palCount = 0;
     Color *palette = NULL;
     Color *pixels = LoadImageColors(image);
@@ -2971,24 +3156,17 @@ Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
 
         for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
 
+        // Colors already on palette are checked with a hash table
+        ColorHashTable table = { 0 };
+
         for (int i = 0; i < image.width*image.height; i++)
         {
             if (pixels[i].a > 0)
             {
-                bool colorInPalette = false;
-
-                // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
-                {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
-                    {
-                        colorInPalette = true;
-                        break;
-                    }
-                }
+                ColorHashEntry *entry = GetColorHashEntry(&table, pixels[i]);
 
                 // Store color if not on the palette
-                if (!colorInPalette)
+                if (entry->count++ == 0)
                 {
                     palette[palCount] = pixels[i];      // Add pixels[i] to palette
                     palCount++;
@@ -3003,6 +3181,7 @@ Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
             }
         }
 
+        RL_FREE(table.entries);
         UnloadImageColors(pixels);
     }
 
@@ -3011,6 +3190,174 @@ Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
     return palette;
 }
 
+// Load colors palette from image as a Color array (RGBA - 32bit), quantized to maxPaletteSize colors
+// NOTE 1: Memory allocated should be freed using UnloadImagePalette()
+// NOTE 2: Median cut quantization, colors boxes weighted by pixels count, transparent pixels are skipped,
+// if image has maxPaletteSize colors or less, palette is the same than LoadImagePalette()
+Color *LoadImagePaletteQuantized(Image image, int maxPaletteSize, int *colorCount)
+{
+    int palCount = 0;
+    Color *palette = NULL;
+    Color *pixels = LoadImageColors(image);
+
+    if ((pixels != NULL) && (maxPaletteSize > 0))
+    {
+        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+
+        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
+
+        // Get colors histogram, unique colors indexed in order of appearance
+        ColorHashTable table = { 0 };
+
+        for (int i = 0; i < image.width*image.height; i++)
+        {
+            if (pixels[i].a > 0)
+            {
+                ColorHashEntry *entry = GetColorHashEntry(&table, pixels[i]);
+                if (entry->count++ == 0) entry->index = table.count - 1;
+            }
+        }
+
+        // Compact histogram entries, sorted by order of appearance
+        ColorHashEntry *colors = (ColorHashEntry *)RL_MALLOC(table.count*sizeof(ColorHashEntry));
+        for (int i = 0; i < table.capacity; i++) if (table.entries[i].count > 0) colors[table.entries[i].index] = table.entries[i];
+
+        if (table.count <= maxPaletteSize)
+        {
+            for (int i = 0; i < table.count; i++) memcpy(&palette[i], &colors[i].color, sizeof(Color));
+            palCount = table.count;
+        }
+        else
+        {
+            // Split colors boxes by weighted median along their widest channel, widest boxes first
+            ColorBox *boxes = (ColorBox *)RL_MALLOC(maxPaletteSize*sizeof(ColorBox));
+            ColorHashEntry *sorted = (ColorHashEntry *)RL_MALLOC(table.count*sizeof(ColorHashEntry));
+            int boxCount = 1;
+            boxes[0] = GetColorBox(colors, 0, table.count);
+
+            while (boxCount < maxPaletteSize)
+            {
+                int split = -1;
+                for (int i = 0; i < boxCount; i++) if ((boxes[i].count > 1) && ((split < 0) || (boxes[i].range > boxes[split].range))) split = i;
+                if ((split < 0) || (boxes[split].range == 0)) break;
+
+                ColorBox box = boxes[split];
+
+                // Sort box colors along channel (counting sort, stable)
+                int channelCount[256] = { 0 };
+                int channelStart[256] = { 0 };
+
+                for (int i = box.first; i < (box.first + box.count); i++) channelCount[((unsigned char *)&colors[i].color)[box.channel]]++;
+                for (int i = 1; i < 256; i++) channelStart[i] = channelStart[i - 1] + channelCount[i - 1];
+
+                for (int i = box.first; i < (box.first + box.count); i++) sorted[channelStart[((unsigned char *)&colors[i].color)[box.channel]]++] = colors[i];
+                memcpy(colors + box.first, sorted, box.count*sizeof(ColorHashEntry));
+
+                // Find weighted median, both boxes keep at least one color
+                long long totalPixels = 0;
+                for (int i = box.first; i < (box.first + box.count); i++) totalPixels += colors[i].count;
+
+                long long pixelsCount = 0;
+                int median = box.first + 1;
+                for (int i = box.first; i < (box.first + box.count - 1); i++)
+                {
+                    pixelsCount += colors[i].count;
+                    median = i + 1;
+                    if (2*pixelsCount >= totalPixels) break;
+                }
+
+                boxes[split] = GetColorBox(colors, box.first, median - box.first);
+                boxes[boxCount] = GetColorBox(colors, median, box.first + box.count - median);
+                boxCount++;
+            }
+
+            // Get palette colors as boxes weighted average
+            for (int i = 0; i < boxCount; i++)
+            {
+                long long sum[4] = { 0 };
+                long long totalPixels = 0;
+
+                for (int j = boxes[i].first; j < (boxes[i].first + boxes[i].count); j++)
+                {
+                    const unsigned char *color = (const unsigned char *)&colors[j].color;
+                    for (int c = 0; c < 4; c++) sum[c] += (long long)color[c]*colors[j].count;
+                    totalPixels += colors[j].count;
+                }
+
+                palette[i] = (Color){ (unsigned char)((sum[0] + totalPixels/2)/totalPixels), (unsigned char)((sum[1] + totalPixels/2)/totalPixels),
+                                      (unsigned char)((sum[2] + totalPixels/2)/totalPixels), (unsigned char)((sum[3] + totalPixels/2)/totalPixels) };
+            }
+
+            palCount = boxCount;
+            RL_FREE(sorted);
+            RL_FREE(boxes);
+        }
+
+        RL_FREE(colors);
+        RL_FREE(table.entries);
+    }
+
+    if (pixels != NULL) UnloadImageColors(pixels);
+
+    *colorCount = palCount;
+
+    return palette;
+}
+
+// Load image pixels as palette indices (nearest palette color), up to 256 colors palette
+// NOTE 1: Memory allocated should be freed using UnloadImagePaletteIndices()
+// NOTE 2: Nearest color is computed once for every unique color in image
+unsigned char *LoadImagePaletteIndices(Image image, Color *palette, int colorCount)
+{
+    if ((palette == NULL) || (colorCount <= 0) || (colorCount > 256))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Palette indices require a palette of 1 to 256 colors");
+        return NULL;
+    }
+
+    unsigned char *indices = NULL;
+    Color *pixels = LoadImageColors(image);
+
+    if (pixels != NULL)
+    {
+        indices = (unsigned char *)RL_MALLOC(image.width*image.height*sizeof(unsigned char));
+        ColorHashTable table = { 0 };
+
+        for (int i = 0; i < image.width*image.height; i++)
+        {
+            ColorHashEntry *entry = GetColorHashEntry(&table, pixels[i]);
+
+            if (entry->count++ == 0)
+            {
+                // Find nearest palette color (squared distance, RGBA)
+                int minDistance = 0x7fffffff;
+
+                for (int j = 0; j < colorCount; j++)
+                {
+                    int dr = (int)pixels[i].r - palette[j].r;
+                    int dg = (int)pixels[i].g - palette[j].g;
+                    int db = (int)pixels[i].b - palette[j].b;
+                    int da = (int)pixels[i].a - palette[j].a;
+                    int distance = dr*dr + dg*dg + db*db + da*da;
+
+                    if (distance < minDistance)
+                    {
+                        minDistance = distance;
+                        entry->index = j;
+                    }
+                }
+            }
+
+            indices[i] = (unsigned char)entry->index;
+        }
+
+        RL_FREE(table.entries);
+        UnloadImageColors(pixels);
+    }
+
+    return indices;
+}
+
 // Unload color data loaded with LoadImageColors()
 void UnloadImageColors(Color *colors)
 {
@@ -3023,6 +3370,12 @@ void UnloadImagePalette(Color *colors)
     RL_FREE(colors);
 }
 
+// Unload palette indices loaded with LoadImagePaletteIndices()
+void UnloadImagePaletteIndices(unsigned char *indices)
+{
+    RL_FREE(indices);
+}
+
 // Get image alpha border rectangle
 // NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
 Rectangle GetImageAlphaBorder(Image image, float threshold)
@@ -3610,9 +3963,18 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
 
         // Check if source rectangle needs to be resized to destination rectangle
-        // In that case, we make a copy of source, and we apply all required transform
+        // Up to 2x downscale, source is sampled directly while drawing, no resized copy required,
+        // otherwise, we make a copy of source, and we apply all required transform
         if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
         {
+            if (((int)srcRec.width > 0) && ((int)srcRec.height > 0) &&
+                ((int)dstRec.width > 0) && ((int)dstRec.height > 0) &&
+                ((int)dstRec.width*2 >= (int)srcRec.width) && ((int)dstRec.height*2 >= (int)srcRec.height))
+            {
+                BlitImageScaled(dst, src, srcRec, dstRec, tint);
+                return;
+            }
+
             srcMod = ImageFromImage(src, srcRec);   // Create image from another image
             ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
             srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
@@ -3650,6 +4012,8 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
+        //    [x] Consider fast path: RGBA8 src/dst formats -> vectorized line blending
+        //    [x] Consider fast path: scaled drawing sampling source directly (no resized copy)
         //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
         //    [ ] Support f32bit channels drawing
 
@@ -3658,8 +4022,8 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         Color colSrc, colDst, blend;
         bool blendRequired = true;
 
-        // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
+        // Fast path: Avoid blend if source has no alpha to blend and no tint is applied
+        if ((tint.r == 255) && (tint.g == 255) && (tint.b == 255) && (tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
 
         int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
         int bytesPerPixelDst = strideDst/(dst->width);
@@ -3677,6 +4041,11 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
 
             // Fast path: Avoid moving pixel by pixel if no blend required and same format
             if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            else if ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+            {
+                // Fast path: Blend full line at once, no pixel format conversion required
+                BlendImageRowR8G8B8A8(pDst, pSrc, (int)srcRec.width, tint);
+            }
             else
             {
                 for (int x = 0; x < (int)srcRec.width; x++)
@@ -4955,74 +5324,1164 @@ int GetPixelDataSize(int width, int height, int format)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
-// From https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
+// Get color hash table entry, added if not found
+// NOTE: Table is allocated on first use and grown when half full, new entries have count 0
+static ColorHashEntry *GetColorHashEntry(ColorHashTable *table, Color color)
+{
+    if ((table->count + 1)*2 > table->capacity)
+    {
+        ColorHashTable grown = { 0 };
+        grown.capacity = (table->capacity > 0)? table->capacity*2 : 256;
+        grown.entries = (ColorHashEntry *)RL_CALLOC(grown.capacity, sizeof(ColorHashEntry));
 
-static float HalfToFloat(unsigned short x) {
-    const unsigned int e = (x&0x7C00)>>10; // exponent
-    const unsigned int m = (x&0x03FF)<<13; // mantissa
-    const float fm = (float)m;
-    const unsigned int v = (*(unsigned int*)&fm)>>23; // evil log2 bit hack to count leading zeros in denormalized format
-    const unsigned int r = (x&0x8000)<<16 | (e!=0)*((e+112)<<23|m) | ((e==0)&(m!=0))*((v-37)<<23|((m<<(150-v))&0x007FE000)); // sign : normalized : denormalized
-    return *(float*)&r;
-}
+        for (int i = 0; i < table->capacity; i++)
+        {
+            if (table->entries[i].count > 0)
+            {
+                unsigned int slot = (table->entries[i].color*2654435761u) & (grown.capacity - 1);
+                while (grown.entries[slot].count > 0) slot = (slot + 1) & (grown.capacity - 1);
+                grown.entries[slot] = table->entries[i];
+            }
+        }
 
-static unsigned short FloatToHalf(float x) {
-    const unsigned int b = (*(unsigned int*)&x)+0x00001000; // round-to-nearest-even: add last bit after truncated mantissa
-    const unsigned int e = (b&0x7F800000)>>23; // exponent
-    const unsigned int m = b&0x007FFFFF; // mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
-    return (b&0x80000000)>>16 | (e>112)*((((e-112)<<10)&0x7C00)|m>>13) | ((e<113)&(e>101))*((((0x007FF000+m)>>(125-e))+1)>>1) | (e>143)*0x7FFF; // sign : normalized : denormalized : saturate
+        grown.count = table->count;
+        RL_FREE(table->entries);
+        *table = grown;
+    }
+
+    unsigned int key = 0;
+    memcpy(&key, &color, sizeof(unsigned int));
+
+    unsigned int slot = (key*2654435761u) & (table->capacity - 1);
+
+    while (table->entries[slot].count > 0)
+    {
+        if (table->entries[slot].color == key) return &table->entries[slot];
+        slot = (slot + 1) & (table->capacity - 1);
+    }
+
+    table->entries[slot].color = key;
+    table->count++;
+
+    return &table->entries[slot];
 }
 
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
+// Get colors box widest channel range
+static ColorBox GetColorBox(const ColorHashEntry *entries, int first, int count)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+    ColorBox box = { first, count, 0, 0 };
+    unsigned char minValue[4] = { 255, 255, 255, 255 };
+    unsigned char maxValue[4] = { 0 };
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+    for (int i = first; i < (first + count); i++)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        const unsigned char *color = (const unsigned char *)&entries[i].color;
+
+        for (int c = 0; c < 4; c++)
         {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+            if (color[c] < minValue[c]) minValue[c] = color[c];
+            if (color[c] > maxValue[c]) maxValue[c] = color[c];
+        }
+    }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+    for (int c = 0; c < 4; c++)
+    {
+        if ((maxValue[c] - minValue[c]) > box.range)
+        {
+            box.range = maxValue[c] - minValue[c];
+            box.channel = c;
+        }
+    }
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    return box;
+}
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+// Blend a row of RGBA8 source pixels over RGBA8 destination pixels, applying tint
+// NOTE: Result is exactly the same as ColorAlphaBlend(), per pixel
+static void BlendImageRowR8G8B8A8(unsigned char *dst, const unsigned char *src, int count, Color tint)
+{
+    bool tinted = ((tint.r != 255) || (tint.g != 255) || (tint.b != 255) || (tint.a != 255));
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    // Process 4 pixels at once, every channel in its own 32bit lanes vector
+    // NOTE: Integer divisions by resulting alpha are estimated with float divisions and
+    // corrected with the exact remainder, all intermediate values are exact in float
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128i full = _mm_set1_epi32(256);
+    const __m128i tintR = _mm_set1_epi32(tint.r + 1);
+    const __m128i tintG = _mm_set1_epi32(tint.g + 1);
+    const __m128i tintB = _mm_set1_epi32(tint.b + 1);
+    const __m128i tintA = _mm_set1_epi32(tint.a + 1);
+    const __m128 fzero = _mm_setzero_ps();
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i*4));
+        __m128i sr = _mm_and_si128(s, mask);
+        __m128i sg = _mm_and_si128(_mm_srli_epi32(s, 8), mask);
+        __m128i sb = _mm_and_si128(_mm_srli_epi32(s, 16), mask);
+        __m128i sa = _mm_srli_epi32(s, 24);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+        if (tinted)
+        {
+            // NOTE: 16bit multiplies are enough, all products fit in 16bit (lanes upper half is 0)
+            sr = _mm_srli_epi32(_mm_mullo_epi16(sr, tintR), 8);
+            sg = _mm_srli_epi32(_mm_mullo_epi16(sg, tintG), 8);
+            sb = _mm_srli_epi32(_mm_mullo_epi16(sb, tintB), 8);
+            sa = _mm_srli_epi32(_mm_mullo_epi16(sa, tintA), 8);
+            s = _mm_or_si128(_mm_or_si128(sr, _mm_slli_epi32(sg, 8)), _mm_or_si128(_mm_slli_epi32(sb, 16), _mm_slli_epi32(sa, 24)));
+        }
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+        __m128i transparent = _mm_cmpeq_epi32(sa, zero);
+        __m128i opaque = _mm_cmpeq_epi32(sa, mask);
+        int transparentMask = _mm_movemask_ps(_mm_castsi128_ps(transparent));
+        int opaqueMask = _mm_movemask_ps(_mm_castsi128_ps(opaque));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        if (transparentMask == 0xf) continue;
+        if (opaqueMask == 0xf) { _mm_storeu_si128((__m128i *)(dst + i*4), s); continue; }
+
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i*4));
+        __m128i da = _mm_srli_epi32(d, 24);
+
+        __m128i alpha = _mm_add_epi32(sa, _mm_set1_epi32(1));
+        __m128i invAlpha = _mm_sub_epi32(full, alpha);
+        __m128i outA = _mm_srli_epi32(_mm_add_epi32(_mm_slli_epi32(alpha, 8), _mm_mullo_epi16(da, invAlpha)), 8);
+        __m128 fdiv = _mm_cvtepi32_ps(_mm_slli_epi32(outA, 8));
+        __m128 finv = _mm_cvtepi32_ps(invAlpha);
+
+        __m128i blend = _mm_slli_epi32(outA, 24);
+
+        for (int c = 0; c < 3; c++)
+        {
+            __m128i sc = (c == 0)? sr : ((c == 1)? sg : sb);
+            __m128i dc = _mm_and_si128(_mm_srli_epi32(d, c*8), mask);
+
+            __m128 fsrc = _mm_cvtepi32_ps(_mm_slli_epi32(_mm_mullo_epi16(sc, alpha), 8));
+            __m128 fdst = _mm_mul_ps(_mm_cvtepi32_ps(_mm_mullo_epi16(dc, da)), finv);
+
+            __m128i q = _mm_cvttps_epi32(_mm_div_ps(_mm_add_ps(fsrc, fdst), fdiv));
+            __m128 remainder = _mm_add_ps(_mm_sub_ps(fsrc, _mm_mul_ps(_mm_cvtepi32_ps(q), fdiv)), fdst);
+            q = _mm_add_epi32(q, _mm_castps_si128(_mm_cmplt_ps(remainder, fzero)));
+            q = _mm_sub_epi32(q, _mm_castps_si128(_mm_cmpge_ps(remainder, fdiv)));
+
+            blend = _mm_or_si128(blend, _mm_slli_epi32(_mm_and_si128(q, mask), c*8));
+        }
+
+        // Select per pixel: transparent source keeps destination, opaque source replaces it
+        __m128i result = _mm_or_si128(_mm_and_si128(opaque, s), _mm_andnot_si128(opaque, blend));
+        result = _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, result));
+
+        _mm_storeu_si128((__m128i *)(dst + i*4), result);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Color colSrc = { src[i*4], src[i*4 + 1], src[i*4 + 2], src[i*4 + 3] };
+
+        if (!tinted && (colSrc.a == 255)) memcpy(dst + i*4, src + i*4, 4);
+        else if (tinted || (colSrc.a > 0))
+        {
+            Color colDst = { dst[i*4], dst[i*4 + 1], dst[i*4 + 2], dst[i*4 + 3] };
+            Color blend = ColorAlphaBlend(colDst, colSrc, tint);
+
+            dst[i*4] = blend.r;
+            dst[i*4 + 1] = blend.g;
+            dst[i*4 + 2] = blend.b;
+            dst[i*4 + 3] = blend.a;
+        }
+    }
+}
+
+// Draw source rectangle scaled into destination rectangle, sampling source directly
+// NOTE: Bilinear filtering (alpha weighted), only two source lines are kept converted to Color
+static void BlitImageScaled(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    int srcX = (int)srcRec.x;
+    int srcY = (int)srcRec.y;
+    int srcWidth = (int)srcRec.width;
+    int srcHeight = (int)srcRec.height;
+    int dstX = (int)dstRec.x;
+    int dstY = (int)dstRec.y;
+    int dstWidth = (int)dstRec.width;
+    int dstHeight = (int)dstRec.height;
+
+    // Destination rectangle visible region (relative to destination rectangle)
+    int startX = (dstX < 0)? -dstX : 0;
+    int startY = (dstY < 0)? -dstY : 0;
+    int endX = ((dstX + dstWidth) > dst->width)? (dst->width - dstX) : dstWidth;
+    int endY = ((dstY + dstHeight) > dst->height)? (dst->height - dstY) : dstHeight;
+
+    if ((startX >= endX) || (startY >= endY)) return;
+
+    int width = endX - startX;
+    int bytesPerPixelSrc = GetPixelDataSize(1, 1, src.format);
+    int bytesPerPixelDst = GetPixelDataSize(1, 1, dst->format);
+
+    // Horizontal samples: source column and next column weight (8bit), computed once
+    int *samplesX = (int *)RL_MALLOC(width*2*sizeof(int));
+    Color *lines = (Color *)RL_MALLOC(2*srcWidth*sizeof(Color));   // Source lines cache (converted to Color)
+    Color *row = (Color *)RL_MALLOC(width*sizeof(Color));           // Sampled destination row
+    int linesY[2] = { -1, -1 };
+
+    for (int x = 0; x < width; x++)
+    {
+        float sampleX = ((float)(startX + x) + 0.5f)*srcWidth/dstWidth - 0.5f;
+        if (sampleX < 0.0f) sampleX = 0.0f;
+
+        int x0 = (int)sampleX;
+        int weight = (int)((sampleX - x0)*256.0f + 0.5f);
+        if (x0 >= (srcWidth - 1)) { x0 = srcWidth - 1; weight = 0; }
+
+        samplesX[x*2] = x0;
+        samplesX[x*2 + 1] = weight;
+    }
+
+    for (int y = startY; y < endY; y++)
+    {
+        float sampleY = ((float)y + 0.5f)*srcHeight/dstHeight - 0.5f;
+        if (sampleY < 0.0f) sampleY = 0.0f;
+
+        int y0 = (int)sampleY;
+        int weightY = (int)((sampleY - y0)*256.0f + 0.5f);
+        if (y0 >= (srcHeight - 1)) { y0 = srcHeight - 1; weightY = 0; }
+        int y1 = (y0 < (srcHeight - 1))? (y0 + 1) : y0;
+
+        // Load required source lines into cache, slot selected by line parity
+        for (int k = 0; k < 2; k++)
+        {
+            int line = (k == 0)? y0 : y1;
+            Color *cached = lines + (line%2)*srcWidth;
+
+            if (linesY[line%2] != line)
+            {
+                const unsigned char *pSrc = (const unsigned char *)src.data + ((srcY + line)*src.width + srcX)*bytesPerPixelSrc;
+
+                if (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) memcpy(cached, pSrc, srcWidth*sizeof(Color));
+                else for (int x = 0; x < srcWidth; x++) cached[x] = GetPixelColor((void *)(pSrc + x*bytesPerPixelSrc), src.format);
+
+                linesY[line%2] = line;
+            }
+        }
+
+        const Color *line0 = lines + (y0%2)*srcWidth;
+        const Color *line1 = lines + (y1%2)*srcWidth;
+
+        for (int x = 0; x < width; x++)
+        {
+            int x0 = samplesX[x*2];
+            int x1 = (x0 < (srcWidth - 1))? (x0 + 1) : x0;
+            int weightX = samplesX[x*2 + 1];
+
+            // Bilinear weights, adding up to 65536
+            unsigned int weights[4] = {
+                (unsigned int)((256 - weightX)*(256 - weightY)), (unsigned int)(weightX*(256 - weightY)),
+                (unsigned int)((256 - weightX)*weightY), (unsigned int)(weightX*weightY)
+            };
+            const Color samples[4] = { line0[x0], line0[x1], line1[x0], line1[x1] };
+
+            // Colors weighted by alpha to avoid transparent pixels colors bleeding
+            unsigned int alpha = 0, r = 0, g = 0, b = 0;
+            for (int k = 0; k < 4; k++)
+            {
+                unsigned int weight = weights[k]*samples[k].a;
+                alpha += weight;
+                r += weight*samples[k].r;
+                g += weight*samples[k].g;
+                b += weight*samples[k].b;
+            }
+
+            if (alpha == 0) row[x] = BLANK;
+            else
+            {
+                row[x].r = (unsigned char)((r + alpha/2)/alpha);
+                row[x].g = (unsigned char)((g + alpha/2)/alpha);
+                row[x].b = (unsigned char)((b + alpha/2)/alpha);
+                row[x].a = (unsigned char)((alpha + 32768) >> 16);
+            }
+        }
+
+        unsigned char *pDst = (unsigned char *)dst->data + ((dstY + y)*dst->width + dstX + startX)*bytesPerPixelDst;
+
+        if (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) BlendImageRowR8G8B8A8(pDst, (unsigned char *)row, width, tint);
+        else
+        {
+            for (int x = 0; x < width; x++)
+            {
+                Color colDst = GetPixelColor(pDst, dst->format);
+                SetPixelColor(pDst, ColorAlphaBlend(colDst, row[x], tint), dst->format);
+                pDst += bytesPerPixelDst;
+            }
+        }
+    }
+
+    RL_FREE(samplesX);
+    RL_FREE(lines);
+    RL_FREE(row);
+}
+
+// Load atlas skyline for atlas width
+// NOTE: Skyline segments are at least 1 pixel wide, atlas width is the maximum segments count
+static rAtlasSkyline *LoadAtlasSkyline(int width)
+{
+    rAtlasSkyline *skyline = (rAtlasSkyline *)RL_CALLOC(1, sizeof(rAtlasSkyline));
+    skyline->nodes = (AtlasSkylineNode *)RL_MALLOC((width + 1)*sizeof(AtlasSkylineNode));
+
+    return skyline;
+}
+
+// Unload atlas skyline
+static void UnloadAtlasSkyline(rAtlasSkyline *skyline)
+{
+    if (skyline != NULL)
+    {
+        RL_FREE(skyline->nodes);
+        RL_FREE(skyline);
+    }
+}
+
+// Reset atlas skyline to empty atlas, width must not exceed skyline loaded width
+static void ResetAtlasSkyline(rAtlasSkyline *skyline, int width)
+{
+    skyline->nodes[0] = (AtlasSkylineNode){ 0, 0, width };
+    skyline->nodeCount = 1;
+}
+
+// Find position for a rectangle in atlas skyline, returns false if rectangle does not fit
+// NOTE: Position is the skyline segment index where rectangle starts and rectangle bottom y,
+// lowest rectangle top is chosen (bottom-left) and then the one wasting less area below rectangle
+static bool FindAtlasSkylinePosition(const rAtlasSkyline *skyline, int atlasWidth, int atlasHeight, int width, int height, int *index, int *y)
+{
+    const AtlasSkylineNode *nodes = skyline->nodes;
+    int bestTop = INT_MAX;
+    int bestWaste = INT_MAX;
+    bool found = false;
+
+    for (int i = 0; i < skyline->nodeCount; i++)
+    {
+        if ((nodes[i].x + width) > atlasWidth) break;
+
+        // Rectangle rests on the highest segment it spans
+        int top = 0;
+        for (int j = i, remaining = width; remaining > 0; remaining -= nodes[j].width, j++)
+        {
+            if (nodes[j].y > top) top = nodes[j].y;
+        }
+
+        if ((top > (atlasHeight - height)) || ((top + height) > bestTop)) continue;
+
+        int waste = 0;
+        for (int j = i, remaining = width; remaining > 0; remaining -= nodes[j].width, j++)
+        {
+            waste += (top - nodes[j].y)*((remaining < nodes[j].width)? remaining : nodes[j].width);
+        }
+
+        if (((top + height) < bestTop) || (waste < bestWaste))
+        {
+            bestTop = top + height;
+            bestWaste = waste;
+            *index = i;
+            *y = top;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+// Add rectangle level to atlas skyline, at position found with FindAtlasSkylinePosition()
+static void AddAtlasSkylineLevel(rAtlasSkyline *skyline, int index, int y, int width, int height)
+{
+    AtlasSkylineNode *nodes = skyline->nodes;
+    int x = nodes[index].x;
+    int right = x + width;
+
+    // Segments below rectangle are removed, last one is shrunk if partially covered
+    int next = index;
+    while ((next < skyline->nodeCount) && ((nodes[next].x + nodes[next].width) <= right)) next++;
+
+    if ((next < skyline->nodeCount) && (nodes[next].x < right))
+    {
+        nodes[next].width -= (right - nodes[next].x);
+        nodes[next].x = right;
+    }
+
+    memmove(&nodes[index + 1], &nodes[next], (skyline->nodeCount - next)*sizeof(AtlasSkylineNode));
+    skyline->nodeCount += (index + 1 - next);
+    nodes[index] = (AtlasSkylineNode){ x, y + height, width };
+
+    // Merge neighbour segments at same height
+    if (((index + 1) < skyline->nodeCount) && (nodes[index + 1].y == nodes[index].y))
+    {
+        nodes[index].width += nodes[index + 1].width;
+        memmove(&nodes[index + 1], &nodes[index + 2], (skyline->nodeCount - index - 2)*sizeof(AtlasSkylineNode));
+        skyline->nodeCount--;
+    }
+
+    if ((index > 0) && (nodes[index - 1].y == nodes[index].y))
+    {
+        nodes[index - 1].width += nodes[index].width;
+        memmove(&nodes[index], &nodes[index + 1], (skyline->nodeCount - index - 1)*sizeof(AtlasSkylineNode));
+        skyline->nodeCount--;
+    }
+}
+
+// Pack rectangles into atlas skyline, in provided order, returns atlas height used, -1 if some rectangle does not fit
+// NOTE: Rectangles positions (x, y) are returned in positions if not NULL
+static int PackAtlasSkyline(rAtlasSkyline *skyline, int atlasWidth, int atlasHeight, const AtlasPackRec *recs, int count, int *positions)
+{
+    int usedHeight = 0;
+
+    ResetAtlasSkyline(skyline, atlasWidth);
+
+    for (int i = 0; i < count; i++)
+    {
+        int index = 0;
+        int y = 0;
+
+        if (!FindAtlasSkylinePosition(skyline, atlasWidth, atlasHeight, recs[i].width, recs[i].height, &index, &y)) return -1;
+
+        if (positions != NULL)
+        {
+            positions[2*i] = skyline->nodes[index].x;
+            positions[2*i + 1] = y;
+        }
+
+        AddAtlasSkylineLevel(skyline, index, y, recs[i].width, recs[i].height);
+
+        if ((y + recs[i].height) > usedHeight) usedHeight = y + recs[i].height;
+    }
+
+    return usedHeight;
+}
+
+// Compare atlas packing rectangles, higher first and then wider first (qsort() callback)
+static int CompareAtlasPackRecs(const void *a, const void *b)
+{
+    const AtlasPackRec *recA = (const AtlasPackRec *)a;
+    const AtlasPackRec *recB = (const AtlasPackRec *)b;
+
+    if (recA->height != recB->height) return (recB->height - recA->height);
+    if (recA->width != recB->width) return (recB->width - recA->width);
+
+    return (recA->index - recB->index);
+}
+
+// Process image rows, split in tiles of at least IMAGE_TASK_MIN_PIXELS run as tasks
+// NOTE: Rows could also be columns or any other independent pixels lines
+static void ProcessImageRows(void (*process)(void *data, int first, int last), void *data, int rows, int rowPixels)
+{
+    ImageRowsTask task = { 0 };
+    task.process = process;
+    task.data = data;
+    task.rows = rows;
+    task.tileRows = (rowPixels > 0)? IMAGE_TASK_MIN_PIXELS/rowPixels : rows;
+    if (task.tileRows < 1) task.tileRows = 1;
+
+    RunTasks(ProcessImageRowsTile, &task, (rows + task.tileRows - 1)/task.tileRows);
+}
+
+// Process image rows tile, task callback
+static void ProcessImageRowsTile(void *data, int index)
+{
+    ImageRowsTask *task = (ImageRowsTask *)data;
+
+    int first = index*task->tileRows;
+    int last = first + task->tileRows;
+    if (last > task->rows) last = task->rows;
+
+    task->process(task->data, first, last);
+}
+
+// Resize 8bit per channel pixel data, output split in parts run as tasks if possible
+// NOTE: Output is the same independently of the splits
+static int ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int layout)
+{
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)layout, STBIR_TYPE_UINT8);
+
+    // NOTE: Every split has a considerable fixed cost (filtering of overlapped input lines),
+    // so splits are kept 16 times bigger than other image processing tasks
+    int splits = IsTaskDispatchReady()? (newWidth*newHeight/(IMAGE_TASK_MIN_PIXELS*16)) : 1;
+    if (splits <= 1) return stbir_resize_extended(&resize);
+
+    splits = stbir_build_samplers_with_splits(&resize, splits);
+    if (splits > 0) RunTasks(ResizeImageDataSplit, &resize, splits);
+    stbir_free_samplers(&resize);
+
+    return (splits > 0);
+}
+
+// Resize pixel data split, task callback
+static void ResizeImageDataSplit(void *data, int index)
+{
+    stbir_resize_extended_split((STBIR_RESIZE *)data, index, 1);
+}
+
+#if defined(RTEXTURES_SIMD_SSE2)
+// Load color channels into 32bit lanes
+static inline __m128i LoadColorLanes(Color color)
+{
+    int value = 0;
+    memcpy(&value, &color, sizeof(Color));
+
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(value), _mm_setzero_si128()), _mm_setzero_si128());
+}
+
+// Get color from channels sums 32bit lanes, averaged with scale (rounded)
+static inline Color GetColorLanesAverage(__m128i sum, __m128 scale)
+{
+    __m128i value = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum), scale), _mm_set1_ps(0.5f)));
+    value = _mm_packs_epi32(value, _mm_setzero_si128());
+
+    int packed = _mm_cvtsi128_si32(_mm_packus_epi16(value, _mm_setzero_si128()));
+    Color color = { 0 };
+    memcpy(&color, &packed, sizeof(Color));
+
+    return color;
+}
+#endif
+
+// Box blur image rows (horizontal), in-place, sliding window sums
+// NOTE: Window is [x - size, x + size], clamped to image borders (averaged over pixels available)
+static void BlurImageRows(void *data, int first, int last)
+{
+    ImageFilterTask *task = (ImageFilterTask *)data;
+    const float *scales = task->scales;
+    int width = task->width;
+    int radius = (task->size < width)? task->size : (width - 1);
+
+    Color *line = (Color *)RL_MALLOC(width*sizeof(Color));     // Original row pixels
+
+    for (int row = first; row < last; row++)
+    {
+        Color *pixels = task->pixels + row*width;
+        memcpy(line, pixels, width*sizeof(Color));
+
+#if defined(RTEXTURES_SIMD_SSE2)
+        __m128i sum = _mm_setzero_si128();
+
+        for (int x = 0; x <= radius; x++) sum = _mm_add_epi32(sum, LoadColorLanes(line[x]));
+
+        for (int x = 0; x < width; x++)
+        {
+            int count = (((x + radius) < width)? (x + radius) : (width - 1)) - (((x - radius) > 0)? (x - radius) : 0) + 1;
+            pixels[x] = GetColorLanesAverage(sum, _mm_set1_ps(scales[count]));
+
+            if ((x + radius + 1) < width) sum = _mm_add_epi32(sum, LoadColorLanes(line[x + radius + 1]));
+            if ((x - radius) >= 0) sum = _mm_sub_epi32(sum, LoadColorLanes(line[x - radius]));
+        }
+#else
+        int sum[4] = { 0 };
+
+        for (int x = 0; x <= radius; x++)
+        {
+            sum[0] += line[x].r;
+            sum[1] += line[x].g;
+            sum[2] += line[x].b;
+            sum[3] += line[x].a;
+        }
+
+        for (int x = 0; x < width; x++)
+        {
+            int count = (((x + radius) < width)? (x + radius) : (width - 1)) - (((x - radius) > 0)? (x - radius) : 0) + 1;
+            pixels[x].r = (unsigned char)((float)sum[0]*scales[count] + 0.5f);
+            pixels[x].g = (unsigned char)((float)sum[1]*scales[count] + 0.5f);
+            pixels[x].b = (unsigned char)((float)sum[2]*scales[count] + 0.5f);
+            pixels[x].a = (unsigned char)((float)sum[3]*scales[count] + 0.5f);
+
+            if ((x + radius + 1) < width)
+            {
+                sum[0] += line[x + radius + 1].r;
+                sum[1] += line[x + radius + 1].g;
+                sum[2] += line[x + radius + 1].b;
+                sum[3] += line[x + radius + 1].a;
+            }
+
+            if ((x - radius) >= 0)
+            {
+                sum[0] -= line[x - radius].r;
+                sum[1] -= line[x - radius].g;
+                sum[2] -= line[x - radius].b;
+                sum[3] -= line[x - radius].a;
+            }
+        }
+#endif
+    }
+
+    RL_FREE(line);
+}
+
+// Box blur image columns (vertical), in-place, sliding window sums
+// NOTE: Columns [first, last) are processed together, line by line, to keep memory accesses sequential,
+// original lines still required by the window are kept in a ring buffer (radius + 1 lines)
+static void BlurImageColumns(void *data, int first, int last)
+{
+    ImageFilterTask *task = (ImageFilterTask *)data;
+    const float *scales = task->scales;
+    int width = task->width;
+    int height = task->height;
+    int radius = (task->size < height)? task->size : (height - 1);
+    int columns = last - first;
+
+    int *sums = (int *)RL_CALLOC(columns*4, sizeof(int));
+    Color *lines = (Color *)RL_MALLOC((radius + 1)*columns*sizeof(Color));   // Original lines ring buffer
+
+    for (int y = 0; y <= radius; y++)
+    {
+        const Color *pixels = task->pixels + y*width + first;
+
+        for (int x = 0; x < columns; x++)
+        {
+            sums[x*4] += pixels[x].r;
+            sums[x*4 + 1] += pixels[x].g;
+            sums[x*4 + 2] += pixels[x].b;
+            sums[x*4 + 3] += pixels[x].a;
+        }
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        Color *pixels = task->pixels + y*width + first;
+        const Color *added = ((y + radius + 1) < height)? (task->pixels + (y + radius + 1)*width + first) : NULL;
+        const Color *removed = ((y - radius) >= 0)? (lines + ((y - radius)%(radius + 1))*columns) : NULL;
+        float scale = scales[(((y + radius) < height)? (y + radius) : (height - 1)) - (((y - radius) > 0)? (y - radius) : 0) + 1];
+
+        memcpy(lines + (y%(radius + 1))*columns, pixels, columns*sizeof(Color));
+
+#if defined(RTEXTURES_SIMD_SSE2)
+        const __m128 scaleLanes = _mm_set1_ps(scale);
+
+        for (int x = 0; x < columns; x++)
+        {
+            __m128i sum = _mm_loadu_si128((__m128i *)(sums + x*4));
+
+            pixels[x] = GetColorLanesAverage(sum, scaleLanes);
+
+            if (added != NULL) sum = _mm_add_epi32(sum, LoadColorLanes(added[x]));
+            if (removed != NULL) sum = _mm_sub_epi32(sum, LoadColorLanes(removed[x]));
+
+            _mm_storeu_si128((__m128i *)(sums + x*4), sum);
+        }
+#else
+        for (int x = 0; x < columns; x++)
+        {
+            int *sum = sums + x*4;
+
+            pixels[x].r = (unsigned char)((float)sum[0]*scale + 0.5f);
+            pixels[x].g = (unsigned char)((float)sum[1]*scale + 0.5f);
+            pixels[x].b = (unsigned char)((float)sum[2]*scale + 0.5f);
+            pixels[x].a = (unsigned char)((float)sum[3]*scale + 0.5f);
+
+            if (added != NULL)
+            {
+                sum[0] += added[x].r;
+                sum[1] += added[x].g;
+                sum[2] += added[x].b;
+                sum[3] += added[x].a;
+            }
+
+            if (removed != NULL)
+            {
+                sum[0] -= removed[x].r;
+                sum[1] -= removed[x].g;
+                sum[2] -= removed[x].b;
+                sum[3] -= removed[x].a;
+            }
+        }
+#endif
+    }
+
+    RL_FREE(sums);
+    RL_FREE(lines);
+}
+
+// Alpha premultiply image rows (rounded)
+static void BlurImagePremultiply(void *data, int first, int last)
+{
+    ImageFilterTask *task = (ImageFilterTask *)data;
+    Color *pixels = task->pixels;
+
+    for (int i = first*task->width; i < last*task->width; i++)
+    {
+        unsigned int alpha = pixels[i].a;
+
+        if (alpha == 0) pixels[i] = BLANK;
+        else if (alpha < 255)
+        {
+            pixels[i].r = (unsigned char)((pixels[i].r*alpha + 127)/255);
+            pixels[i].g = (unsigned char)((pixels[i].g*alpha + 127)/255);
+            pixels[i].b = (unsigned char)((pixels[i].b*alpha + 127)/255);
+        }
+    }
+}
+
+// Reverse alpha premultiply on image rows (rounded)
+static void BlurImageUnpremultiply(void *data, int first, int last)
+{
+    ImageFilterTask *task = (ImageFilterTask *)data;
+    Color *pixels = task->pixels;
+
+    for (int i = first*task->width; i < last*task->width; i++)
+    {
+        unsigned int alpha = pixels[i].a;
+
+        if (alpha == 0) pixels[i] = BLANK;
+        else if (alpha < 255)
+        {
+            unsigned int r = (pixels[i].r*255 + alpha/2)/alpha;
+            unsigned int g = (pixels[i].g*255 + alpha/2)/alpha;
+            unsigned int b = (pixels[i].b*255 + alpha/2)/alpha;
+
+            pixels[i].r = (unsigned char)((r > 255)? 255 : r);
+            pixels[i].g = (unsigned char)((g > 255)? 255 : g);
+            pixels[i].b = (unsigned char)((b > 255)? 255 : b);
+        }
+    }
+}
+
+// Apply convolution kernel to image rows, image pixels are read and results stored into output values
+static void ConvolveImageRows(void *data, int first, int last)
+{
+    ImageFilterTask *task = (ImageFilterTask *)data;
+    const Color *pixels = task->pixels;
+    const float *kernel = task->kernel;
+    Vector4 *output = task->output;
+    int width = task->width;
+    int height = task->height;
+    int kernelWidth = task->size;
+    int kernelSize = kernelWidth*kernelWidth;
+
+    Vector4 *temp = RL_CALLOC(kernelSize, sizeof(Vector4));
+
+    float rRes = 0.0f;
+    float gRes = 0.0f;
+    float bRes = 0.0f;
+    float aRes = 0.0f;
+
+    int startRange = -kernelWidth/2;
+    int endRange = ((kernelWidth%2) == 0)? kernelWidth/2 : kernelWidth/2 + 1;
+
+    for (int x = first; x < last; x++)
+    {
+        for (int y = 0; y < width; y++)
+        {
+            for (int xk = startRange; xk < endRange; xk++)
+            {
+                for (int yk = startRange; yk < endRange; yk++)
+                {
+                    int xkabs = xk + kernelWidth/2;
+                    int ykabs = yk + kernelWidth/2;
+                    size_t imgindex = width*(x+xk) + (y+yk);
+
+                    if (imgindex >= (size_t)(width*height))
+                    {
+                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
+                    }
+                    else
+                    {
+                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                    }
+                }
+            }
+
+            for (int i = 0; i < kernelSize; i++)
+            {
+                rRes += temp[i].x;
+                gRes += temp[i].y;
+                bRes += temp[i].z;
+                aRes += temp[i].w;
+            }
+
+            if (rRes < 0.0f) rRes = 0.0f;
+            if (gRes < 0.0f) gRes = 0.0f;
+            if (bRes < 0.0f) bRes = 0.0f;
+
+            if (rRes > 1.0f) rRes = 1.0f;
+            if (gRes > 1.0f) gRes = 1.0f;
+            if (bRes > 1.0f) bRes = 1.0f;
+
+            output[width*x + y].x = rRes;
+            output[width*x + y].y = gRes;
+            output[width*x + y].z = bRes;
+            output[width*x + y].w = aRes;
+
+            rRes = 0.0f;
+            gRes = 0.0f;
+            bRes = 0.0f;
+            aRes = 0.0f;
+
+            memset(temp, 0, kernelSize*sizeof(Vector4));
+        }
+    }
+
+    RL_FREE(temp);
+}
+
+// Apply color tint to image rows
+static void TintImageRows(void *data, int first, int last)
+{
+    ImageColorTask *task = (ImageColorTask *)data;
+    Color *pixels = task->pixels;
+
+    float cR = (float)task->color.r/255;
+    float cG = (float)task->color.g/255;
+    float cB = (float)task->color.b/255;
+    float cA = (float)task->color.a/255;
+
+    for (int index = first*task->width; index < last*task->width; index++)
+    {
+        unsigned char r = (unsigned char)(((float)pixels[index].r/255*cR)*255.0f);
+        unsigned char g = (unsigned char)(((float)pixels[index].g/255*cG)*255.0f);
+        unsigned char b = (unsigned char)(((float)pixels[index].b/255*cB)*255.0f);
+        unsigned char a = (unsigned char)(((float)pixels[index].a/255*cA)*255.0f);
+
+        pixels[index].r = r;
+        pixels[index].g = g;
+        pixels[index].b = b;
+        pixels[index].a = a;
+    }
+}
+
+// Invert colors of image rows
+static void InvertImageRows(void *data, int first, int last)
+{
+    ImageColorTask *task = (ImageColorTask *)data;
+    Color *pixels = task->pixels;
+
+    for (int index = first*task->width; index < last*task->width; index++)
+    {
+        pixels[index].r = 255 - pixels[index].r;
+        pixels[index].g = 255 - pixels[index].g;
+        pixels[index].b = 255 - pixels[index].b;
+    }
+}
+
+// Apply contrast to image rows
+static void ContrastImageRows(void *data, int first, int last)
+{
+    ImageColorTask *task = (ImageColorTask *)data;
+    Color *pixels = task->pixels;
+    float contrast = task->contrast;
+
+    for (int index = first*task->width; index < last*task->width; index++)
+    {
+        float pR = (float)pixels[index].r/255.0f;
+        pR -= 0.5f;
+        pR *= contrast;
+        pR += 0.5f;
+        pR *= 255;
+        if (pR < 0) pR = 0;
+        if (pR > 255) pR = 255;
+
+        float pG = (float)pixels[index].g/255.0f;
+        pG -= 0.5f;
+        pG *= contrast;
+        pG += 0.5f;
+        pG *= 255;
+        if (pG < 0) pG = 0;
+        if (pG > 255) pG = 255;
+
+        float pB = (float)pixels[index].b/255.0f;
+        pB -= 0.5f;
+        pB *= contrast;
+        pB += 0.5f;
+        pB *= 255;
+        if (pB < 0) pB = 0;
+        if (pB > 255) pB = 255;
+
+        pixels[index].r = (unsigned char)pR;
+        pixels[index].g = (unsigned char)pG;
+        pixels[index].b = (unsigned char)pB;
+    }
+}
+
+// Apply brightness to image rows
+static void BrightnessImageRows(void *data, int first, int last)
+{
+    ImageColorTask *task = (ImageColorTask *)data;
+    Color *pixels = task->pixels;
+    int brightness = task->brightness;
+
+    for (int index = first*task->width; index < last*task->width; index++)
+    {
+        int cR = pixels[index].r + brightness;
+        int cG = pixels[index].g + brightness;
+        int cB = pixels[index].b + brightness;
+
+        if (cR < 0) cR = 1;
+        if (cR > 255) cR = 255;
+
+        if (cG < 0) cG = 1;
+        if (cG > 255) cG = 255;
+
+        if (cB < 0) cB = 1;
+        if (cB > 255) cB = 255;
+
+        pixels[index].r = (unsigned char)cR;
+        pixels[index].g = (unsigned char)cG;
+        pixels[index].b = (unsigned char)cB;
+    }
+}
+
+// Replace color in image rows, only pixels matching all color channels (alpha included)
+static void ReplaceImageRows(void *data, int first, int last)
+{
+    ImageColorTask *task = (ImageColorTask *)data;
+    Color *pixels = task->pixels;
+    Color color = task->color;
+
+    for (int index = first*task->width; index < last*task->width; index++)
+    {
+        if ((pixels[index].r == color.r) &&
+            (pixels[index].g == color.g) &&
+            (pixels[index].b == color.b) &&
+            (pixels[index].a == color.a)) pixels[index] = task->replace;
+    }
+}
+
+// Convert pixel data between uncompressed formats without float normalization
+// NOTE: Supported source formats are 8-bit per channel ones (and 16-bit packed ones to R8G8B8/R8G8B8A8),
+// pixels are decoded by chunks into a Color buffer and encoded with lookup tables, results are the same
+// than float normalized conversion, returns NULL if formats pair is not supported
+static void *ConvertImageDataDirect(const void *data, int pixelCount, int format, int newFormat)
+{
+    bool packedFormat = (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) || (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) || (format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4);
+
+    // Check source format
+    // NOTE: Packed formats can only be converted to 8-bit RGB formats to match float conversion rounding
+    if ((format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) &&
+        (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && !packedFormat) return NULL;
+    if (packedFormat && (newFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (newFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) return NULL;
+
+    // Check destination format
+    if ((newFormat != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (newFormat != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) &&
+        (newFormat != PIXELFORMAT_UNCOMPRESSED_R5G6B5) && (newFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8) &&
+        (newFormat != PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) && (newFormat != PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) &&
+        (newFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) return NULL;
+
+    // Generate lookup tables, computed the same way than float normalized conversion
+    ConvertDirectTask *task = (ConvertDirectTask *)RL_CALLOC(1, sizeof(ConvertDirectTask));
+
+    for (int i = 0; i < 256; i++)
+    {
+        float value = (float)i/255.0f;
+        task->grayR[i] = value*0.299f;
+        task->grayG[i] = value*0.587f;
+        task->grayB[i] = value*0.114f;
+        task->to4bit[i] = (unsigned char)(round(value*15.0f));
+        task->to5bit[i] = (unsigned char)(round(value*31.0f));
+        task->to6bit[i] = (unsigned char)(round(value*63.0f));
+    }
+
+    for (int i = 0; i < 16; i++) task->from4bit[i] = (unsigned char)((float)i*(1.0f/15)*255.0f);
+    for (int i = 0; i < 32; i++) task->from5bit[i] = (unsigned char)((float)i*(1.0f/31)*255.0f);
+    for (int i = 0; i < 64; i++) task->from6bit[i] = (unsigned char)((float)i*(1.0f/63)*255.0f);
+
+    task->data = data;
+    task->newData = (unsigned char *)RL_MALLOC(pixelCount*GetPixelDataSize(1, 1, newFormat));
+    task->format = format;
+    task->newFormat = newFormat;
+
+    // Pixels are processed as one pixel rows, split in tiles of IMAGE_TASK_MIN_PIXELS
+    ProcessImageRows(ConvertImageDataDirectRows, task, pixelCount, 1);
+
+    unsigned char *newData = task->newData;
+    RL_FREE(task);
+
+    return newData;
+}
+
+// Convert pixels range, direct conversion task
+static void ConvertImageDataDirectRows(void *data, int first, int last)
+{
+    #define CONVERT_CHUNK_PIXELS    1024
+
+    const ConvertDirectTask *task = (const ConvertDirectTask *)data;
+    const float *grayR = task->grayR;
+    const float *grayG = task->grayG;
+    const float *grayB = task->grayB;
+    const unsigned char *to4bit = task->to4bit;
+    const unsigned char *to5bit = task->to5bit;
+    const unsigned char *to6bit = task->to6bit;
+    const unsigned char *from4bit = task->from4bit;
+    const unsigned char *from5bit = task->from5bit;
+    const unsigned char *from6bit = task->from6bit;
+    const void *pixelData = task->data;
+    int format = task->format;
+    int newFormat = task->newFormat;
+    int newPixelSize = GetPixelDataSize(1, 1, newFormat);
+    Color buffer[CONVERT_CHUNK_PIXELS] = { 0 };
+
+    for (int offset = first; offset < last; offset += CONVERT_CHUNK_PIXELS)
+    {
+        int count = ((last - offset) < CONVERT_CHUNK_PIXELS)? (last - offset) : CONVERT_CHUNK_PIXELS;
+        const Color *pixels = buffer;
+
+        // Decode source pixels into Color buffer (R8G8B8A8 pixels are used directly)
+        switch (format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            {
+                const unsigned char *src = (const unsigned char *)pixelData + offset;
+                for (int i = 0; i < count; i++) buffer[i] = (Color){ src[i], src[i], src[i], 255 };
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                const unsigned char *src = (const unsigned char *)pixelData + offset*2;
+                for (int i = 0; i < count; i++) buffer[i] = (Color){ src[i*2], src[i*2], src[i*2], src[i*2 + 1] };
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                const unsigned short *src = (const unsigned short *)pixelData + offset;
+                for (int i = 0; i < count; i++) buffer[i] = (Color){ from5bit[(src[i] >> 11) & 0x1f], from6bit[(src[i] >> 5) & 0x3f], from5bit[src[i] & 0x1f], 255 };
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                const unsigned short *src = (const unsigned short *)pixelData + offset;
+                for (int i = 0; i < count; i++) buffer[i] = (Color){ from5bit[(src[i] >> 11) & 0x1f], from5bit[(src[i] >> 6) & 0x1f], from5bit[(src[i] >> 1) & 0x1f], (src[i] & 0x1)? 255 : 0 };
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                const unsigned short *src = (const unsigned short *)pixelData + offset;
+                for (int i = 0; i < count; i++) buffer[i] = (Color){ from4bit[(src[i] >> 12) & 0xf], from4bit[(src[i] >> 8) & 0xf], from4bit[(src[i] >> 4) & 0xf], from4bit[src[i] & 0xf] };
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                const unsigned char *src = (const unsigned char *)pixelData + offset*3;
+                for (int i = 0; i < count; i++) buffer[i] = (Color){ src[i*3], src[i*3 + 1], src[i*3 + 2], 255 };
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: pixels = (const Color *)pixelData + offset; break;
+            default: break;
+        }
+
+        // Encode Color pixels into destination format
+        unsigned char *dst = task->newData + offset*newPixelSize;
+
+        switch (newFormat)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            {
+                for (int i = 0; i < count; i++) dst[i] = (unsigned char)((grayR[pixels[i].r] + grayG[pixels[i].g] + grayB[pixels[i].b])*255.0f);
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    dst[i*2] = (unsigned char)((grayR[pixels[i].r] + grayG[pixels[i].g] + grayB[pixels[i].b])*255.0f);
+                    dst[i*2 + 1] = pixels[i].a;
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short *dst16 = (unsigned short *)dst;
+                for (int i = 0; i < count; i++) dst16[i] = (unsigned short)to5bit[pixels[i].r] << 11 | (unsigned short)to6bit[pixels[i].g] << 5 | (unsigned short)to5bit[pixels[i].b];
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short *dst16 = (unsigned short *)dst;
+                for (int i = 0; i < count; i++)
+                {
+                    dst16[i] = (unsigned short)to5bit[pixels[i].r] << 11 | (unsigned short)to5bit[pixels[i].g] << 6 | (unsigned short)to5bit[pixels[i].b] << 1 |
+                               ((pixels[i].a > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0);
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short *dst16 = (unsigned short *)dst;
+                for (int i = 0; i < count; i++) dst16[i] = (unsigned short)to4bit[pixels[i].r] << 12 | (unsigned short)to4bit[pixels[i].g] << 8 | (unsigned short)to4bit[pixels[i].b] << 4 | (unsigned short)to4bit[pixels[i].a];
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    dst[i*3] = pixels[i].r;
+                    dst[i*3 + 1] = pixels[i].g;
+                    dst[i*3 + 2] = pixels[i].b;
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(dst, pixels, count*sizeof(Color)); break;
+            default: break;
+        }
+    }
+}
+
+// From https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
+
+static float HalfToFloat(unsigned short x) {
+    const unsigned int e = (x&0x7C00)>>10; // exponent
+    const unsigned int m = (x&0x03FF)<<13; // mantissa
+    const float fm = (float)m;
+    const unsigned int v = (*(unsigned int*)&fm)>>23; // evil log2 bit hack to count leading zeros in denormalized format
+    const unsigned int r = (x&0x8000)<<16 | (e!=0)*((e+112)<<23|m) | ((e==0)&(m!=0))*((v-37)<<23|((m<<(150-v))&0x007FE000)); // sign : normalized : denormalized
+    return *(float*)&r;
+}
+
+static unsigned short FloatToHalf(float x) {
+    const unsigned int b = (*(unsigned int*)&x)+0x00001000; // round-to-nearest-even: add last bit after truncated mantissa
+    const unsigned int e = (b&0x7F800000)>>23; // exponent
+    const unsigned int m = b&0x007FFFFF; // mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+    return (b&0x80000000)>>16 | (e>112)*((((e-112)<<10)&0x7C00)|m>>13) | ((e<113)&(e>101))*((((0x007FF000+m)>>(125-e))+1)>>1) | (e>143)*0x7FFF; // sign : normalized : denormalized : saturate
+}
+
+// Get pixel data from image as Vector4 array (float normalized)
+static Vector4 *LoadImageDataNormalized(Image image)
+{
+    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
                 {
                     unsigned short pixel = ((unsigned short *)image.data)[i];
 
@@ -5109,4 +6568,614 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// Encode PNG file data, row bands filtered and deflated in parallel
+// NOTE: Every band is deflated independently (fixed Huffman codes) with previous bands data as
+// matches window, non-last bands end with a sync flush (empty stored block) so they are byte aligned
+// and can be concatenated as a single zlib stream, every band is written as a separate IDAT chunk
+static unsigned char *EncodeImagePNG(const unsigned char *pixels, int width, int height, int channels, int level, int *dataSize)
+{
+    static const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+    static const unsigned char colorTypes[5] = { 0, 0, 4, 2, 6 };   // By channels: gray, gray+alpha, RGB, RGBA
+
+    *dataSize = 0;
+    if ((width <= 0) || (height <= 0) || (channels < 1) || (channels > 4)) return NULL;
+
+    PNGEncodeTask task = { 0 };
+    task.pixels = pixels;
+    task.width = width;
+    task.height = height;
+    task.channels = channels;
+    task.level = (level < 0)? DEFLATE_DEFAULT_LEVEL : ((level > 9)? 9 : level);
+    task.rowSize = width*channels + 1;
+    task.filtered = (unsigned char *)RL_MALLOC(height*task.rowSize);
+    task.bandRows = IsTaskDispatchReady()? (IMAGE_ENCODE_BAND_PIXELS + width - 1)/width : height;
+    if (task.bandRows > height) task.bandRows = height;
+    task.bandCount = (height + task.bandRows - 1)/task.bandRows;
+    task.chunks = (unsigned char **)RL_CALLOC(task.bandCount, sizeof(unsigned char *));
+    task.chunkSizes = (int *)RL_CALLOC(task.bandCount, sizeof(int));
+    task.adlers = (unsigned int *)RL_CALLOC(task.bandCount, sizeof(unsigned int));
+    InitDeflateCodes(&task.codes);
+
+    // Filter all rows first, bands deflate requires previous bands filtered data
+    ProcessImageRows(FilterPNGRows, &task, height, width);
+    RunTasks(DeflatePNGBand, &task, task.bandCount);
+
+    // Combine bands Adler-32 checksums into zlib stream checksum
+    unsigned int adler = task.adlers[0];
+    for (int i = 1; i < task.bandCount; i++)
+    {
+        int bandRows = (i == (task.bandCount - 1))? (height - i*task.bandRows) : task.bandRows;
+        unsigned int remainder = (unsigned int)(bandRows*task.rowSize)%65521;
+        unsigned int sum1 = adler & 0xffff;
+        unsigned int sum2 = (remainder*sum1)%65521;
+
+        sum1 += (task.adlers[i] & 0xffff) + 65521 - 1;
+        sum2 += ((adler >> 16) & 0xffff) + ((task.adlers[i] >> 16) & 0xffff) + 65521 - remainder;
+        if (sum1 >= 65521) sum1 -= 65521;
+        if (sum1 >= 65521) sum1 -= 65521;
+        if (sum2 >= (65521 << 1)) sum2 -= (65521 << 1);
+        if (sum2 >= 65521) sum2 -= 65521;
+
+        adler = sum1 | (sum2 << 16);
+    }
+
+    // Compose PNG: signature, IHDR, bands IDAT chunks, zlib checksum IDAT chunk, IEND
+    int size = 8 + (12 + 13) + (12 + 4) + 12;
+    for (int i = 0; i < task.bandCount; i++) size += task.chunkSizes[i];
+
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(size);
+    unsigned char *output = fileData;
+
+    memcpy(output, signature, 8);
+    output += 8;
+
+    unsigned char *header = output + 8;
+    header[0] = (unsigned char)(width >> 24); header[1] = (unsigned char)(width >> 16); header[2] = (unsigned char)(width >> 8); header[3] = (unsigned char)width;
+    header[4] = (unsigned char)(height >> 24); header[5] = (unsigned char)(height >> 16); header[6] = (unsigned char)(height >> 8); header[7] = (unsigned char)height;
+    header[8] = 8;                          // Bit depth
+    header[9] = colorTypes[channels];       // Color type
+    header[10] = 0;                         // Compression method
+    header[11] = 0;                         // Filter method
+    header[12] = 0;                         // Interlace method
+    output = WritePNGChunk(output, "IHDR", 13);
+
+    for (int i = 0; i < task.bandCount; i++)
+    {
+        memcpy(output, task.chunks[i], task.chunkSizes[i]);
+        output += task.chunkSizes[i];
+        RL_FREE(task.chunks[i]);
+    }
+
+    unsigned char *checksum = output + 8;
+    checksum[0] = (unsigned char)(adler >> 24); checksum[1] = (unsigned char)(adler >> 16); checksum[2] = (unsigned char)(adler >> 8); checksum[3] = (unsigned char)adler;
+    output = WritePNGChunk(output, "IDAT", 4);
+    output = WritePNGChunk(output, "IEND", 0);
+
+    RL_FREE(task.filtered);
+    RL_FREE(task.chunks);
+    RL_FREE(task.chunkSizes);
+    RL_FREE(task.adlers);
+
+    *dataSize = size;
+
+    return fileData;
+}
+
+// Write PNG chunk length, type and CRC, chunk data must be already placed after length and type
+// NOTE: Returns next chunk position
+static unsigned char *WritePNGChunk(unsigned char *output, const char *type, int size)
+{
+    output[0] = (unsigned char)(size >> 24);
+    output[1] = (unsigned char)(size >> 16);
+    output[2] = (unsigned char)(size >> 8);
+    output[3] = (unsigned char)size;
+    memcpy(output + 4, type, 4);
+
+    unsigned int crc = stbiw__crc32(output + 4, size + 4);
+    unsigned char *end = output + 8 + size;
+    end[0] = (unsigned char)(crc >> 24);
+    end[1] = (unsigned char)(crc >> 16);
+    end[2] = (unsigned char)(crc >> 8);
+    end[3] = (unsigned char)crc;
+
+    return end + 4;
+}
+
+// Apply PNG filters to image rows, best filter per row
+// NOTE: Filter selection is the same used by stb_image_write, minimum sum of absolute values
+static void FilterPNGRows(void *data, int first, int last)
+{
+    PNGEncodeTask *task = (PNGEncodeTask *)data;
+    int rowBytes = task->width*task->channels;
+    signed char *line = (signed char *)RL_MALLOC(rowBytes);
+
+    for (int y = first; y < last; y++)
+    {
+        unsigned char *row = task->filtered + y*task->rowSize;
+        int filter = 0;
+
+        // NOTE: No compression, filters would not help, rows are just copied
+        if (task->level == 0) memcpy(row + 1, task->pixels + y*rowBytes, rowBytes);
+        else
+        {
+            int bestEstimate = 0x7fffffff;
+
+            for (int type = 0; type < 5; type++)
+            {
+                stbiw__encode_png_line((unsigned char *)task->pixels, rowBytes, task->width, task->height, y, task->channels, type, line);
+
+                int estimate = 0;
+                for (int i = 0; i < rowBytes; i++) estimate += abs(line[i]);
+
+                if (estimate < bestEstimate)
+                {
+                    bestEstimate = estimate;
+                    filter = type;
+                    memcpy(row + 1, line, rowBytes);
+                }
+            }
+        }
+
+        row[0] = (unsigned char)filter;
+    }
+
+    RL_FREE(line);
+}
+
+// Deflate PNG filtered rows band into an IDAT chunk, task callback
+static void DeflatePNGBand(void *data, int index)
+{
+    PNGEncodeTask *task = (PNGEncodeTask *)data;
+    int start = index*task->bandRows*task->rowSize;
+    int end = (index == (task->bandCount - 1))? task->height*task->rowSize : start + task->bandRows*task->rowSize;
+    int length = end - start;
+
+    // NOTE: Output capacity covers worst cases, fixed Huffman literals (9 bits) or stored blocks
+    unsigned char *chunk = (unsigned char *)RL_MALLOC(12 + 2 + length + length/8 + 64);
+    unsigned char *output = chunk + 8;
+    int size = 0;
+
+    if (index == 0)
+    {
+        output[size++] = 0x78;      // zlib header: deflate, 32K window
+        output[size++] = 0x5e;
+    }
+
+    size += DeflateData(task->filtered, start, end, task->level, (index == (task->bandCount - 1)), &task->codes, output + size);
+    WritePNGChunk(chunk, "IDAT", size);
+
+    // Compute band Adler-32 checksum
+    unsigned int sum1 = 1;
+    unsigned int sum2 = 0;
+
+    for (int i = start; i < end; )
+    {
+        int blockEnd = ((end - i) > 5552)? i + 5552 : end;
+        for (; i < blockEnd; i++)
+        {
+            sum1 += task->filtered[i];
+            sum2 += sum1;
+        }
+
+        sum1 %= 65521;
+        sum2 %= 65521;
+    }
+
+    task->chunks[index] = chunk;
+    task->chunkSizes[index] = 12 + size;
+    task->adlers[index] = (sum2 << 16) | sum1;
+}
+
+// Init deflate fixed Huffman codes
+static void InitDeflateCodes(DeflateCodes *codes)
+{
+    for (int i = 0; i < 288; i++)
+    {
+        int code = 0;
+        int bits = 0;
+
+        if (i < 144) { code = 0x30 + i; bits = 8; }
+        else if (i < 256) { code = 0x190 + i - 144; bits = 9; }
+        else if (i < 280) { code = i - 256; bits = 7; }
+        else { code = 0xc0 + i - 280; bits = 8; }
+
+        int reversed = 0;
+        for (int b = 0; b < bits; b++) reversed |= ((code >> b) & 1) << (bits - 1 - b);
+
+        codes->literalCodes[i] = (unsigned short)reversed;
+        codes->literalBits[i] = (unsigned char)bits;
+    }
+
+    for (int i = 0; i < 30; i++)
+    {
+        int reversed = 0;
+        for (int b = 0; b < 5; b++) reversed |= ((i >> b) & 1) << (4 - b);
+        codes->distanceCodes[i] = (unsigned char)reversed;
+    }
+
+    for (int s = 0; s < 29; s++)
+    {
+        int next = (s < 28)? deflateLengthBase[s + 1] : (DEFLATE_MAX_MATCH + 1);
+        for (int length = deflateLengthBase[s]; length < next; length++) codes->lengthSymbols[length] = (unsigned char)s;
+    }
+
+    for (int s = 0; s < 30; s++)
+    {
+        int next = (s < 29)? deflateDistanceBase[s + 1] : (DEFLATE_WINDOW_SIZE + 1);
+        for (int distance = deflateDistanceBase[s]; distance < next; distance++)
+        {
+            if (distance <= 256) codes->distanceSymbols[distance - 1] = (unsigned char)s;
+            else codes->distanceSymbols[256 + ((distance - 1) >> 7)] = (unsigned char)s;
+        }
+    }
+}
+
+// Write bits to deflate stream (LSB first)
+static inline void WriteDeflateBits(DeflateStream *stream, unsigned int value, int count)
+{
+    stream->bits |= value << stream->bitCount;
+    stream->bitCount += count;
+
+    while (stream->bitCount >= 8)
+    {
+        stream->data[stream->size++] = (unsigned char)stream->bits;
+        stream->bits >>= 8;
+        stream->bitCount -= 8;
+    }
+}
+
+// Insert data position into deflate matches hash chains
+static inline void InsertDeflateHash(const unsigned char *data, int position, int *head, int *prev)
+{
+    unsigned int hash = (((unsigned int)data[position] << 10) ^ ((unsigned int)data[position + 1] << 5) ^ data[position + 2]) & (DEFLATE_HASH_SIZE - 1);
+
+    prev[position & (DEFLATE_WINDOW_SIZE - 1)] = head[hash];
+    head[hash] = position;
+}
+
+// Find longest deflate match for data position, searching hash chains
+// NOTE: Position must not be inserted yet, all chain positions are previous positions
+static inline int FindDeflateMatch(const unsigned char *data, int position, int end, const int *head, const int *prev, int maxChain, int niceLength, int *distance)
+{
+    int bestLength = 0;
+    int maxLength = ((end - position) < DEFLATE_MAX_MATCH)? (end - position) : DEFLATE_MAX_MATCH;
+
+    if (maxLength < DEFLATE_MIN_MATCH) return 0;
+
+    unsigned int hash = (((unsigned int)data[position] << 10) ^ ((unsigned int)data[position + 1] << 5) ^ data[position + 2]) & (DEFLATE_HASH_SIZE - 1);
+    int candidate = head[hash];
+    const unsigned char *current = data + position;
+
+    while ((candidate >= 0) && (maxChain-- > 0))
+    {
+        int candidateDistance = position - candidate;
+        if (candidateDistance >= DEFLATE_WINDOW_SIZE) break;
+
+        const unsigned char *match = data + candidate;
+
+        if ((match[bestLength] == current[bestLength]) && (match[0] == current[0]) && (match[1] == current[1]))
+        {
+            int length = 2;
+            while ((length < maxLength) && (match[length] == current[length])) length++;
+
+            if (length > bestLength)
+            {
+                bestLength = length;
+                *distance = candidateDistance;
+                if ((length >= niceLength) || (length >= maxLength)) break;
+            }
+        }
+
+        candidate = prev[candidate & (DEFLATE_WINDOW_SIZE - 1)];
+    }
+
+    // NOTE: Short matches far away cost more bits than literals
+    if ((bestLength < DEFLATE_MIN_MATCH) || ((bestLength == DEFLATE_MIN_MATCH) && (*distance > 4096))) bestLength = 0;
+
+    return bestLength;
+}
+
+// Deflate data range [start, end) as raw deflate blocks, returns output size in bytes
+// NOTE: Data before start (up to window size) is used as matches window, if not last,
+// output ends with a sync flush (empty stored block) to be byte aligned for next data range
+static int DeflateData(const unsigned char *data, int start, int end, int level, bool last, const DeflateCodes *codes, unsigned char *output)
+{
+    static const int maxChains[10] = { 0, 4, 8, 16, 32, 64, 128, 256, 1024, 4096 };
+    static const int niceLengths[10] = { 0, 8, 16, 32, 32, 64, 128, 128, 258, 258 };
+
+    int length = end - start;
+    int storedSize = length + 5*((length + 65534)/65535);
+    DeflateStream stream = { output, 0, 0, 0 };
+
+    if (level > 0)
+    {
+        int *head = (int *)RL_MALLOC(DEFLATE_HASH_SIZE*sizeof(int));
+        int *prev = (int *)RL_MALLOC(DEFLATE_WINDOW_SIZE*sizeof(int));
+        for (int i = 0; i < DEFLATE_HASH_SIZE; i++) head[i] = -1;
+
+        // Insert previous data in matches window, decoder has it as previous output
+        int hashed = (start > DEFLATE_WINDOW_SIZE)? (start - DEFLATE_WINDOW_SIZE) : 0;
+        int hashEnd = end - (DEFLATE_MIN_MATCH - 1);    // Hashed positions require 3 bytes available
+        for (; hashed < start; hashed++) InsertDeflateHash(data, hashed, head, prev);
+
+        WriteDeflateBits(&stream, last? 1 : 0, 1);      // Final block flag
+        WriteDeflateBits(&stream, 1, 2);                // Block type: fixed Huffman codes
+
+        int position = start;
+        int lazyLength = -1;    // Match found at position by lazy evaluation, -1 if not searched
+        int lazyDistance = 0;
+
+        while (position < end)
+        {
+            int distance = 0;
+            int matchLength = lazyLength;
+            if (matchLength >= 0) distance = lazyDistance;
+            else matchLength = FindDeflateMatch(data, position, end, head, prev, maxChains[level], niceLengths[level], &distance);
+            lazyLength = -1;
+
+            for (; (hashed <= position) && (hashed < hashEnd); hashed++) InsertDeflateHash(data, hashed, head, prev);
+
+            // Lazy evaluation: if next position has a longer match, current byte is emitted as literal
+            if ((level >= 4) && (matchLength > 0) && (matchLength < niceLengths[level]) && ((position + 1) < end))
+            {
+                lazyLength = FindDeflateMatch(data, position + 1, end, head, prev, maxChains[level], niceLengths[level], &lazyDistance);
+                if (lazyLength > matchLength) matchLength = 0;
+                else lazyLength = -1;
+            }
+
+            if (matchLength > 0)
+            {
+                int symbol = codes->lengthSymbols[matchLength];
+                WriteDeflateBits(&stream, codes->literalCodes[257 + symbol], codes->literalBits[257 + symbol]);
+                if (deflateLengthExtra[symbol] > 0) WriteDeflateBits(&stream, matchLength - deflateLengthBase[symbol], deflateLengthExtra[symbol]);
+
+                symbol = (distance <= 256)? codes->distanceSymbols[distance - 1] : codes->distanceSymbols[256 + ((distance - 1) >> 7)];
+                WriteDeflateBits(&stream, codes->distanceCodes[symbol], 5);
+                if (deflateDistanceExtra[symbol] > 0) WriteDeflateBits(&stream, distance - deflateDistanceBase[symbol], deflateDistanceExtra[symbol]);
+
+                position += matchLength;
+                for (; (hashed < position) && (hashed < hashEnd); hashed++) InsertDeflateHash(data, hashed, head, prev);
+            }
+            else
+            {
+                WriteDeflateBits(&stream, codes->literalCodes[data[position]], codes->literalBits[data[position]]);
+                position++;
+            }
+        }
+
+        WriteDeflateBits(&stream, codes->literalCodes[256], codes->literalBits[256]);  // End of block
+
+        if (!last)
+        {
+            // Sync flush: empty stored block, aligned to byte boundary
+            WriteDeflateBits(&stream, 0, 3);
+            if (stream.bitCount > 0) WriteDeflateBits(&stream, 0, 8 - stream.bitCount);
+            WriteDeflateBits(&stream, 0x0000, 16);
+            WriteDeflateBits(&stream, 0xffff, 16);
+        }
+        else if (stream.bitCount > 0) WriteDeflateBits(&stream, 0, 8 - stream.bitCount);
+
+        RL_FREE(head);
+        RL_FREE(prev);
+    }
+
+    // Store data uncompressed if no compression requested or data could not be compressed
+    // NOTE: Stored blocks start byte aligned, previous data range ended byte aligned
+    if ((level == 0) || (stream.size >= storedSize))
+    {
+        stream.size = 0;
+
+        for (int i = start; i < end; )
+        {
+            int blockSize = ((end - i) > 65535)? 65535 : (end - i);
+
+            output[stream.size++] = (last && ((i + blockSize) == end))? 1 : 0;
+            output[stream.size++] = (unsigned char)blockSize;
+            output[stream.size++] = (unsigned char)(blockSize >> 8);
+            output[stream.size++] = (unsigned char)~blockSize;
+            output[stream.size++] = (unsigned char)(~blockSize >> 8);
+            memcpy(output + stream.size, data + i, blockSize);
+
+            stream.size += blockSize;
+            i += blockSize;
+        }
+    }
+
+    return stream.size;
+}
+#endif      // SUPPORT_IMAGE_EXPORT && SUPPORT_FILEFORMAT_PNG
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_QOI)
+// Encode QOI file data, pixel bands encoded in parallel
+// NOTE: QOI encoder state at any pixel can be computed from previous pixels: previous pixel and
+// colors index (last pixel seen for every index entry), every band encoder starts with that state
+// so the output decodes as a regular QOI stream, only runs are split at bands boundaries
+static unsigned char *EncodeImageQOI(const unsigned char *pixels, int width, int height, int channels, int *dataSize)
+{
+    static const unsigned char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+    *dataSize = 0;
+
+    int pixelCount = width*height;
+    int bandCount = IsTaskDispatchReady()? (pixelCount/IMAGE_ENCODE_BAND_PIXELS) : 1;
+
+    // Single band uses reference encoder
+    if (bandCount <= 1)
+    {
+        qoi_desc desc = { 0 };
+        desc.width = width;
+        desc.height = height;
+        desc.channels = channels;
+        desc.colorspace = QOI_SRGB;
+
+        return (unsigned char *)qoi_encode(pixels, &desc, dataSize);
+    }
+
+    QOIEncodeTask task = { 0 };
+    task.pixels = pixels;
+    task.channels = channels;
+    task.pixelCount = pixelCount;
+    task.bandPixels = (pixelCount + bandCount - 1)/bandCount;
+    task.bands = (QOIEncodeBand *)RL_CALLOC(bandCount, sizeof(QOIEncodeBand));
+
+    // Get bands colors index at band start: last colors seen on previous bands
+    RunTasks(IndexQOIBand, &task, bandCount);
+
+    Color index[64] = { 0 };
+    for (int i = 0; i < bandCount; i++)
+    {
+        for (int k = 0; k < 64; k++)
+        {
+            Color color = task.bands[i].index[k];
+            task.bands[i].index[k] = index[k];
+            if (task.bands[i].used[k]) index[k] = color;
+        }
+    }
+
+    RunTasks(EncodeQOIBand, &task, bandCount);
+
+    int size = 14 + 8;
+    for (int i = 0; i < bandCount; i++) size += task.bands[i].size;
+
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(size);
+    unsigned char *output = fileData;
+
+    memcpy(output, "qoif", 4);
+    output[4] = (unsigned char)(width >> 24); output[5] = (unsigned char)(width >> 16); output[6] = (unsigned char)(width >> 8); output[7] = (unsigned char)width;
+    output[8] = (unsigned char)(height >> 24); output[9] = (unsigned char)(height >> 16); output[10] = (unsigned char)(height >> 8); output[11] = (unsigned char)height;
+    output[12] = (unsigned char)channels;
+    output[13] = QOI_SRGB;
+    output += 14;
+
+    for (int i = 0; i < bandCount; i++)
+    {
+        memcpy(output, task.bands[i].data, task.bands[i].size);
+        output += task.bands[i].size;
+        RL_FREE(task.bands[i].data);
+    }
+
+    memcpy(output, padding, 8);
+
+    RL_FREE(task.bands);
+
+    *dataSize = size;
+
+    return fileData;
+}
+
+// Get QOI band last seen colors per index entry, task callback
+static void IndexQOIBand(void *data, int index)
+{
+    QOIEncodeTask *task = (QOIEncodeTask *)data;
+    QOIEncodeBand *band = &task->bands[index];
+    int first = index*task->bandPixels;
+    int last = ((first + task->bandPixels) < task->pixelCount)? (first + task->bandPixels) : task->pixelCount;
+
+    for (int i = first; i < last; i++)
+    {
+        const unsigned char *pixel = task->pixels + i*task->channels;
+        Color color = { pixel[0], pixel[1], pixel[2], (task->channels == 4)? pixel[3] : 255 };
+        int hash = (color.r*3 + color.g*5 + color.b*7 + color.a*11)%64;
+
+        band->index[hash] = color;
+        band->used[hash] = true;
+    }
+}
+
+// Encode QOI pixels band, task callback
+// NOTE: Same encoding as qoi_encode(), starting from band index and previous band last pixel
+static void EncodeQOIBand(void *data, int index)
+{
+    QOIEncodeTask *task = (QOIEncodeTask *)data;
+    QOIEncodeBand *band = &task->bands[index];
+    int first = index*task->bandPixels;
+    int last = ((first + task->bandPixels) < task->pixelCount)? (first + task->bandPixels) : task->pixelCount;
+
+    Color previous = { 0, 0, 0, 255 };
+    if (first > 0)
+    {
+        const unsigned char *pixel = task->pixels + (first - 1)*task->channels;
+        previous = (Color){ pixel[0], pixel[1], pixel[2], (task->channels == 4)? pixel[3] : 255 };
+    }
+
+    unsigned char *output = (unsigned char *)RL_MALLOC((last - first)*(task->channels + 1));
+    int size = 0;
+    int run = 0;
+
+    for (int i = first; i < last; i++)
+    {
+        const unsigned char *pixel = task->pixels + i*task->channels;
+        Color color = { pixel[0], pixel[1], pixel[2], (task->channels == 4)? pixel[3] : 255 };
+
+        if ((color.r == previous.r) && (color.g == previous.g) && (color.b == previous.b) && (color.a == previous.a))
+        {
+            run++;
+
+            if ((run == 62) || (i == (last - 1)))
+            {
+                output[size++] = QOI_OP_RUN | (run - 1);
+                run = 0;
+            }
+        }
+        else
+        {
+            if (run > 0)
+            {
+                output[size++] = QOI_OP_RUN | (run - 1);
+                run = 0;
+            }
+
+            int hash = (color.r*3 + color.g*5 + color.b*7 + color.a*11)%64;
+            Color entry = band->index[hash];
+
+            if ((entry.r == color.r) && (entry.g == color.g) && (entry.b == color.b) && (entry.a == color.a)) output[size++] = QOI_OP_INDEX | hash;
+            else
+            {
+                band->index[hash] = color;
+
+                if (color.a == previous.a)
+                {
+                    signed char vr = (signed char)(color.r - previous.r);
+                    signed char vg = (signed char)(color.g - previous.g);
+                    signed char vb = (signed char)(color.b - previous.b);
+                    signed char vgr = vr - vg;
+                    signed char vgb = vb - vg;
+
+                    if ((vr > -3) && (vr < 2) && (vg > -3) && (vg < 2) && (vb > -3) && (vb < 2))
+                    {
+                        output[size++] = QOI_OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2);
+                    }
+                    else if ((vgr > -9) && (vgr < 8) && (vg > -33) && (vg < 32) && (vgb > -9) && (vgb < 8))
+                    {
+                        output[size++] = QOI_OP_LUMA | (vg + 32);
+                        output[size++] = (vgr + 8) << 4 | (vgb + 8);
+                    }
+                    else
+                    {
+                        output[size++] = QOI_OP_RGB;
+                        output[size++] = color.r;
+                        output[size++] = color.g;
+                        output[size++] = color.b;
+                    }
+                }
+                else
+                {
+                    output[size++] = QOI_OP_RGBA;
+                    output[size++] = color.r;
+                    output[size++] = color.g;
+                    output[size++] = color.b;
+                    output[size++] = color.a;
+                }
+            }
+        }
+
+        previous = color;
+    }
+
+    band->data = output;
+    band->size = size;
+}
+#endif      // SUPPORT_IMAGE_EXPORT && SUPPORT_FILEFORMAT_QOI
+
 #endif      // SUPPORT_MODULE_RTEXTURES
@@ -66,6 +66,7 @@ static LoadFileDataCallback loadFileData = NULL;    // LoadFileData callback fun
 static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback function pointer
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
+static TaskDispatchCallback dispatchTasks = NULL;   // Tasks dispatch callback function pointer
 
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
@@ -75,6 +76,7 @@ void SetLoadFileDataCallback(LoadFileDataCallback callback) { loadFileData = cal
 void SetSaveFileDataCallback(SaveFileDataCallback callback) { saveFileData = callback; }  // Set custom file data saver
 void SetLoadFileTextCallback(LoadFileTextCallback callback) { loadFileText = callback; }  // Set custom file text loader
 void SetSaveFileTextCallback(SaveFileTextCallback callback) { saveFileText = callback; }  // Set custom file text saver
+void SetTaskDispatchCallback(TaskDispatchCallback callback) { dispatchTasks = callback; }  // Set custom tasks dispatcher
 
 
 #if defined(PLATFORM_ANDROID)
@@ -179,6 +181,22 @@ void MemFree(void *ptr)
     RL_FREE(ptr);
 }
 
+// Run tasks, [0..count) indices, in parallel if a tasks dispatcher is set
+// NOTE: Tasks must be independent, results must not depend on execution order
+// WARNING: Not only called from main thread, TakeScreenshotAsync() encodes images on capture worker thread,
+// a custom dispatcher must accept calls from any thread
+void RunTasks(void (*task)(void *data, int index), void *data, int count)
+{
+    if ((dispatchTasks != NULL) && (count > 1)) dispatchTasks(task, data, count);
+    else for (int i = 0; i < count; i++) task(data, i);
+}
+
+// Check if tasks can run in parallel (tasks dispatcher set)
+bool IsTaskDispatchReady(void)
+{
+    return (dispatchTasks != NULL);
+}
+
 // Load data from file into a buffer
 unsigned char *LoadFileData(const char *fileName, int *dataSize)
 {
@@ -69,6 +69,9 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+void RunTasks(void (*task)(void *data, int index), void *data, int count);   // Run tasks, in parallel if a tasks dispatcher is set
+bool IsTaskDispatchReady(void);                                             // Check if tasks can run in parallel (tasks dispatcher set)
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!